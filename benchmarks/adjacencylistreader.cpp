@@ -0,0 +1,103 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "graph.incidencelist/incidencelistgraph.h"
+#include "io/adjacencyliststringreader.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+
+using namespace Algora;
+
+typedef std::chrono::steady_clock Clock;
+
+// writes a random graph in adjacency list format
+void generate(const std::string &fileName, unsigned long long n, unsigned long long degree)
+{
+    std::ofstream out(fileName);
+    std::mt19937_64 rnd(42);
+    std::uniform_int_distribution<unsigned long long> dist(0ULL, n - 1ULL);
+    std::string line;
+    out << n << '\n';
+    for (auto v = 0ULL; v < n; v++) {
+        line.clear();
+        for (auto i = 0ULL; i < degree; i++) {
+            if (i > 0ULL) {
+                line.push_back(' ');
+            }
+            line += std::to_string(dist(rnd));
+        }
+        line.push_back('\n');
+        out << line;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc > 1 && std::string(argv[1]) == "-h") {
+        std::cout << "Usage: " << argv[0] << " [adjacency list file | numVertices [avgDegree]]" << std::endl;
+        return 0;
+    }
+
+    std::string fileName;
+    bool generated = false;
+    if (argc == 2 && std::ifstream(argv[1]).good()) {
+        fileName = argv[1];
+    } else {
+        auto n = argc > 1 ? std::stoull(argv[1]) : 1000000ULL;
+        auto degree = argc > 2 ? std::stoull(argv[2]) : 16ULL;
+        fileName = "adjacencylist.benchmark.tmp";
+        std::cerr << "Generating " << fileName << " with " << n << " vertices of out-degree "
+                  << degree << "..." << std::endl;
+        generate(fileName, n, degree);
+        generated = true;
+    }
+
+    std::ifstream input(fileName, std::ios::binary);
+    input.seekg(0, std::ios::end);
+    auto bytes = static_cast<unsigned long long>(input.tellg());
+    input.seekg(0, std::ios::beg);
+
+    IncidenceListGraph graph;
+    AdjacencyListStringReader reader(&input);
+    auto start = Clock::now();
+    bool ok = reader.provideDiGraph(&graph);
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    if (!ok) {
+        std::cerr << "Reading failed: " << reader.getLastError() << std::endl;
+    }
+
+    std::cout << "benchmark,bytes,vertices,arcs,seconds,mb_per_second,arcs_per_second" << std::endl;
+    std::cout << "adjacencylist_read," << bytes << "," << graph.getSize() << "," << graph.getNumArcs(true)
+              << "," << seconds << "," << bytes / seconds / 1e6
+              << "," << graph.getNumArcs(true) / seconds << std::endl;
+
+    if (generated) {
+        std::remove(fileName.c_str());
+    }
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,97 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "graph.incidencelist/incidencelistgraph.h"
+#include "io/adjacencymatrixrw.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Algora;
+
+typedef std::chrono::steady_clock Clock;
+
+template<typename Fun>
+double measure(const Fun &fun)
+{
+    auto start = Clock::now();
+    fun();
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc > 1 && std::string(argv[1]) == "-h") {
+        std::cout << "Usage: " << argv[0] << " [numVertices [density]]" << std::endl;
+        return 0;
+    }
+    auto n = argc > 1 ? std::stoul(argv[1]) : 4000UL;
+    auto density = argc > 2 ? std::stod(argv[2]) : 0.25;
+
+    std::cerr << "Generating graph with " << n << " vertices and density " << density << "..." << std::endl;
+    IncidenceListGraph graph;
+    std::vector<Vertex*> vertices;
+    for (auto i = 0UL; i < n; i++) {
+        vertices.push_back(graph.addVertex());
+    }
+    std::mt19937_64 rnd(42);
+    std::bernoulli_distribution arc(density);
+    for (auto i = 0UL; i < n; i++) {
+        for (auto j = 0UL; j < n; j++) {
+            if (arc(rnd)) {
+                graph.addArc(vertices[i], vertices[j]);
+            }
+        }
+    }
+
+    std::cout << "benchmark,bytes,arcs,seconds,mb_per_second,arcs_per_second" << std::endl;
+    auto report = [&graph](const std::string &name, std::size_t bytes, double seconds) {
+        std::cout << name << "," << bytes << "," << graph.getNumArcs(true) << "," << seconds
+                  << "," << bytes / seconds / 1e6 << "," << graph.getNumArcs(true) / seconds << std::endl;
+    };
+
+    for (bool packed : { false, true }) {
+        std::string mode = packed ? "packed" : "text";
+        AdjacencyMatrixRW rw(true, false, false, packed);
+        std::ostringstream out;
+        rw.setOutputStream(&out);
+        double seconds = measure([&]() { rw.processGraph(&graph); });
+        std::string data = out.str();
+        report("adjacencymatrix_write_" + mode, data.size(), seconds);
+
+        std::istringstream in(data);
+        rw.setInputStream(&in);
+        IncidenceListGraph copy;
+        seconds = measure([&]() { rw.provideDiGraph(&copy); });
+        if (copy.getNumArcs(true) != graph.getNumArcs(true)) {
+            std::cerr << "Mismatch after reading " << mode << " matrix." << std::endl;
+            return 1;
+        }
+        report("adjacencymatrix_read_" + mode, data.size(), seconds);
+    }
+
+    return 0;
+}
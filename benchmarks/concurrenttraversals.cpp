@@ -0,0 +1,179 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+// Stress test for the read-only access mode of IncidenceListGraph: many
+// traversals run in parallel on one graph, their results are checked against
+// sequential runs. Build the library and this program with -fsanitize=thread
+// to have ThreadSanitizer look for data races, e.g.
+//   make concurrenttraversals CC="g++ -fsanitize=thread -g"
+
+#include "graph.incidencelist/incidencelistgraph.h"
+#include "property/fastpropertymap.h"
+#include "algorithm.basic.traversal/breadthfirstsearch.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Algora;
+
+typedef std::chrono::steady_clock Clock;
+
+// number of reached vertices and a hash of all levels
+struct Fingerprint {
+    unsigned long long reached = 0ULL;
+    unsigned long long hash = 0ULL;
+
+    void add(const Vertex *v, unsigned long long level) {
+        reached++;
+        hash += (v->getId() + 1ULL) * 0x9E3779B97F4A7C15ULL ^ level;
+    }
+    bool operator==(const Fingerprint &other) const {
+        return reached == other.reached && hash == other.hash;
+    }
+};
+
+double secondsSince(const Clock::time_point &start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+void report(const std::string &what, unsigned int threads, unsigned long long traversals, double seconds) {
+    std::cout << what << "," << threads << "," << traversals << "," << seconds
+              << "," << (seconds > 0.0 ? traversals / seconds : 0.0) << std::endl;
+}
+
+// through the DiGraph interface, as any algorithm does
+Fingerprint runBfs(DiGraph *graph, const Vertex *start, const std::vector<Vertex*> &vertices) {
+    BreadthFirstSearch<FastPropertyMap> bfs(true, false);
+    FastPropertyMap<DiGraph::size_type> levels(BreadthFirstSearch<FastPropertyMap>::INF);
+    bfs.setGraph(graph);
+    bfs.setStartVertex(start);
+    bfs.useModifiableProperty(&levels);
+    Fingerprint f;
+    if (!bfs.prepare()) {
+        return f;
+    }
+    bfs.run();
+    for (const Vertex *v : vertices) {
+        auto l = levels.getValue(v);
+        if (l != BreadthFirstSearch<FastPropertyMap>::INF) {
+            f.add(v, l);
+        }
+    }
+    return f;
+}
+
+// through the const interface of IncidenceListGraph
+Fingerprint runConstBfs(const IncidenceListGraph &graph, const Vertex *start) {
+    FastPropertyMap<DiGraph::size_type> levels(BreadthFirstSearch<FastPropertyMap>::INF);
+    std::vector<const Vertex*> queue { start };
+    levels[start] = 0ULL;
+    Fingerprint f;
+    for (auto i = 0ULL; i < queue.size(); i++) {
+        const Vertex *v = queue[i];
+        auto l = levels.getValue(v);
+        f.add(v, l);
+        graph.mapOutgoingArcs(v, [&](Arc *a) {
+            auto *head = a->getHead();
+            if (levels.getValue(head) == BreadthFirstSearch<FastPropertyMap>::INF) {
+                levels[head] = l + 1ULL;
+                queue.push_back(head);
+            }
+        });
+    }
+    return f;
+}
+
+template<typename Traversal>
+bool runInParallel(const std::string &name, unsigned int numThreads,
+                   const std::vector<const Vertex*> &starts,
+                   const std::vector<Fingerprint> &expected, const Traversal &traverse) {
+    std::vector<Fingerprint> results(starts.size());
+    std::vector<std::thread> threads;
+    auto start = Clock::now();
+    for (auto t = 0U; t < numThreads; t++) {
+        threads.emplace_back([&, t]() {
+            for (auto q = t; q < starts.size(); q += numThreads) {
+                results[q] = traverse(starts[q]);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    report(name, numThreads, starts.size(), secondsSince(start));
+    for (auto q = 0ULL; q < starts.size(); q++) {
+        if (!(results[q] == expected[q])) {
+            std::cerr << name << ": traversal " << q << " differs from sequential run." << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned long long n = argc > 1 ? std::stoull(argv[1]) : 100000ULL;
+    unsigned int numThreads = argc > 2 ? static_cast<unsigned int>(std::stoul(argv[2]))
+                                       : std::max(std::thread::hardware_concurrency(), 2U);
+    unsigned long long queriesPerThread = argc > 3 ? std::stoull(argv[3]) : 8ULL;
+    if (n == 0ULL || numThreads == 0U) {
+        std::cerr << "Usage: " << argv[0] << " [vertices] [threads] [traversals per thread]" << std::endl;
+        return 1;
+    }
+
+    IncidenceListGraph graph;
+    std::vector<Vertex*> vertices;
+    vertices.reserve(n);
+    for (auto i = 0ULL; i < n; i++) {
+        vertices.push_back(graph.addVertex());
+    }
+    std::mt19937_64 rnd(42ULL);
+    for (auto i = 0ULL; i < 4ULL * n; i++) {
+        graph.addArc(vertices[rnd() % n], vertices[rnd() % n]);
+    }
+
+    std::vector<const Vertex*> starts;
+    for (auto q = 0ULL; q < numThreads * queriesPerThread; q++) {
+        starts.push_back(vertices[(q * 7919ULL) % n]);
+    }
+    std::vector<Fingerprint> expected;
+    auto start = Clock::now();
+    for (const Vertex *s : starts) {
+        expected.push_back(runBfs(&graph, s, vertices));
+    }
+    std::cout << "benchmark,threads,traversals,seconds,per_second" << std::endl;
+    report("bfs_sequential", 1U, starts.size(), secondsSince(start));
+
+    bool ok = runInParallel("bfs_parallel", numThreads, starts, expected, [&](const Vertex *s) {
+        return runBfs(&graph, s, vertices);
+    });
+    const IncidenceListGraph &constGraph = graph;
+    ok &= runInParallel("bfs_const_parallel", numThreads, starts, expected, [&](const Vertex *s) {
+        return runConstBfs(constGraph, s);
+    });
+
+    return ok ? 0 : 1;
+}
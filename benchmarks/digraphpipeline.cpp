@@ -0,0 +1,209 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+// Stress test for DiGraphPipeline: runs many small graphs through pipelines
+// with varying numbers of workers and capacities, ordered and unordered, and
+// checks that every graph yields exactly one correct result, in order where
+// requested. Also checks that exceptions thrown by a worker or the sink stop
+// the pipeline and reach the caller. Build with -fsanitize=thread to have
+// ThreadSanitizer look for data races, e.g.
+//   make digraphpipeline CC="g++ -fsanitize=thread -g"
+
+#include "pipe/digraphpipeline.h"
+#include "graph/digraph.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Algora;
+
+typedef std::chrono::steady_clock Clock;
+typedef DiGraphPipeline<unsigned long long> Pipeline;
+
+// graph i has i % 17 + 1 vertices and a ring of arcs plus some chords
+class SyntheticProvider : public DiGraphProvider
+{
+public:
+    explicit SyntheticProvider(unsigned long long numGraphs) : numGraphs(numGraphs), next(0ULL) { }
+
+    virtual bool isGraphAvailable() override { return next < numGraphs; }
+    virtual bool provideDiGraph(DiGraph *graph) override {
+        if (next >= numGraphs) {
+            return false;
+        }
+        auto n = size(next);
+        std::vector<Vertex*> vertices;
+        for (auto v = 0ULL; v < n; v++) {
+            vertices.push_back(graph->addVertex());
+        }
+        for (auto v = 0ULL; v < n; v++) {
+            graph->addArc(vertices[v], vertices[(v + 1ULL) % n]);
+            if (v % 3ULL == next % 3ULL) {
+                graph->addArc(vertices[v], vertices[(v * 7ULL + next) % n]);
+            }
+        }
+        next++;
+        return true;
+    }
+
+    static unsigned long long size(unsigned long long i) { return i % 17ULL + 1ULL; }
+
+    // what fingerprint() yields for graph i
+    static unsigned long long expected(unsigned long long i) {
+        auto n = size(i);
+        auto chords = 0ULL;
+        for (auto v = 0ULL; v < n; v++) {
+            if (v % 3ULL == i % 3ULL) {
+                chords++;
+            }
+        }
+        return n * 1000ULL + n + chords;
+    }
+
+private:
+    unsigned long long numGraphs;
+    unsigned long long next;
+};
+
+unsigned long long fingerprint(DiGraph *graph) {
+    return graph->getSize() * 1000ULL + graph->getNumArcs(true);
+}
+
+double secondsSince(const Clock::time_point &start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+void report(const std::string &what, unsigned int workers, unsigned long long graphs, double seconds) {
+    std::cout << what << "," << workers << "," << graphs << "," << seconds
+              << "," << (seconds > 0.0 ? graphs / seconds : 0.0) << std::endl;
+}
+
+// workers sleep a little now and then, so that results finish out of order
+bool runAndCheck(const std::string &name, unsigned int workers, Pipeline::size_type capacity,
+                 bool ordered, unsigned long long numGraphs) {
+    SyntheticProvider provider(numGraphs);
+    Pipeline pipeline(workers, capacity, ordered);
+    std::vector<unsigned int> seen(numGraphs, 0U);
+    Pipeline::size_type nextExpected = 0ULL;
+    bool ok = true;
+
+    auto start = Clock::now();
+    auto delivered = pipeline.run(&provider, [](DiGraph *graph, unsigned int worker) {
+        thread_local std::mt19937 rnd(worker + 1U);
+        if (rnd() % 8U == 0U) {
+            std::this_thread::sleep_for(std::chrono::microseconds(rnd() % 200U));
+        }
+        return fingerprint(graph);
+    }, [&](Pipeline::size_type sequence, unsigned long long &&result) {
+        if (ordered && sequence != nextExpected) {
+            std::cerr << name << ": got graph " << sequence << ", expected " << nextExpected << "." << std::endl;
+            ok = false;
+        }
+        nextExpected++;
+        if (sequence >= numGraphs) {
+            std::cerr << name << ": unknown graph " << sequence << "." << std::endl;
+            ok = false;
+            return;
+        }
+        seen[sequence]++;
+        if (result != SyntheticProvider::expected(sequence)) {
+            std::cerr << name << ": wrong result for graph " << sequence << "." << std::endl;
+            ok = false;
+        }
+    });
+    report(name, pipeline.getNumWorkers(), numGraphs, secondsSince(start));
+
+    if (delivered != numGraphs) {
+        std::cerr << name << ": " << delivered << " of " << numGraphs << " results delivered." << std::endl;
+        ok = false;
+    }
+    for (auto i = 0ULL; i < numGraphs; i++) {
+        if (seen[i] != 1U) {
+            std::cerr << name << ": graph " << i << " delivered " << seen[i] << " times." << std::endl;
+            ok = false;
+            break;
+        }
+    }
+    return ok;
+}
+
+// the pipeline must stop and rethrow instead of hanging or losing the error
+bool runAndExpectThrow(const std::string &name, unsigned int workers, bool throwInSink,
+                       unsigned long long numGraphs, unsigned long long failAt) {
+    SyntheticProvider provider(numGraphs);
+    Pipeline pipeline(workers, 2U);
+    auto start = Clock::now();
+    try {
+        pipeline.run(&provider, [&](DiGraph *graph, unsigned int) {
+            auto result = fingerprint(graph);
+            if (!throwInSink && result == SyntheticProvider::expected(failAt)) {
+                throw std::runtime_error("worker failed");
+            }
+            return result;
+        }, [&](Pipeline::size_type sequence, unsigned long long &&) {
+            if (throwInSink && sequence == failAt) {
+                throw std::runtime_error("sink failed");
+            }
+        });
+    } catch (const std::runtime_error &) {
+        report(name, pipeline.getNumWorkers(), numGraphs, secondsSince(start));
+        return true;
+    }
+    std::cerr << name << ": exception did not reach the caller." << std::endl;
+    return false;
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned long long numGraphs = argc > 1 ? std::stoull(argv[1]) : 100000ULL;
+    unsigned int numWorkers = argc > 2 ? static_cast<unsigned int>(std::stoul(argv[2]))
+                                       : std::max(std::thread::hardware_concurrency(), 4U);
+    if (numGraphs == 0ULL || numWorkers == 0U) {
+        std::cerr << "Usage: " << argv[0] << " [graphs] [workers]" << std::endl;
+        return 1;
+    }
+
+    std::cout << "benchmark,workers,graphs,seconds,per_second" << std::endl;
+    bool ok = true;
+    ok &= runAndCheck("ordered", numWorkers, 0U, true, numGraphs);
+    ok &= runAndCheck("unordered", numWorkers, 0U, false, numGraphs);
+    ok &= runAndCheck("ordered_capacity_1", numWorkers, 1U, true, numGraphs / 10ULL + 1ULL);
+    ok &= runAndCheck("ordered_single_worker", 1U, 0U, true, numGraphs / 10ULL + 1ULL);
+    // more workers than graphs, most of them never get work
+    ok &= runAndCheck("ordered_idle_workers", 4U * numWorkers, 0U, true, 3ULL);
+    ok &= runAndCheck("unordered_idle_workers", 4U * numWorkers, 0U, false, 3ULL);
+    ok &= runAndCheck("no_graphs", numWorkers, 0U, true, 0ULL);
+
+    for (auto failAt : { 0ULL, 5ULL, 1000ULL }) {
+        ok &= runAndExpectThrow("throwing_worker_" + std::to_string(failAt), numWorkers, false, 10000ULL, failAt);
+        ok &= runAndExpectThrow("throwing_sink_" + std::to_string(failAt), numWorkers, true, 10000ULL, failAt);
+    }
+    ok &= runAndExpectThrow("throwing_worker_idle_workers", 4U * numWorkers, false, 3ULL, 2ULL);
+
+    return ok ? 0 : 1;
+}
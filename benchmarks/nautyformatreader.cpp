@@ -0,0 +1,163 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "graph.incidencelist/incidencelistgraph.h"
+#include "io/nautyformatreader.h"
+#include "io/sparsesixformat.h"
+#include "io/sparsesixgraphrw.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Algora;
+
+typedef std::chrono::steady_clock Clock;
+
+// random collections of small graphs, one per line
+struct Collections {
+    std::string sparseSix;
+    std::string graphSix;
+    std::string digraphSix;
+};
+
+Collections generate(unsigned long long numGraphs, unsigned int n, double density)
+{
+    Collections c;
+    std::mt19937_64 rnd(42);
+    std::bernoulli_distribution arc(density);
+    std::vector<std::vector<bool>> matrix(n, std::vector<bool>(n));
+    SparseSixGraphRW writer;
+    std::ostringstream sparseSix;
+    writer.setOutputStream(&sparseSix);
+    for (auto g = 0ULL; g < numGraphs; g++) {
+        IncidenceListGraph graph;
+        std::vector<Vertex*> vertices;
+        for (auto i = 0U; i < n; i++) {
+            vertices.push_back(graph.addVertex());
+        }
+        for (auto i = 0U; i < n; i++) {
+            for (auto j = 0U; j < n; j++) {
+                matrix[i][j] = i != j && arc(rnd);
+                if (matrix[i][j]) {
+                    graph.addArc(vertices[i], vertices[j]);
+                }
+            }
+        }
+        writer.processGraph(&graph);
+
+        std::string line;
+        appendSparseSixN(line, n);
+        {
+            SparseSixBitWriter bits(line);
+            for (auto j = 1U; j < n; j++) {
+                for (auto i = 0U; i < j; i++) {
+                    bits.putBit(matrix[i][j] || matrix[j][i]);
+                }
+            }
+            bits.flush();
+        }
+        c.graphSix += line + "\n";
+
+        line = "&";
+        appendSparseSixN(line, n);
+        {
+            SparseSixBitWriter bits(line);
+            for (auto i = 0U; i < n; i++) {
+                for (auto j = 0U; j < n; j++) {
+                    bits.putBit(matrix[i][j]);
+                }
+            }
+            bits.flush();
+        }
+        c.digraphSix += line + "\n";
+    }
+    c.sparseSix = sparseSix.str();
+    return c;
+}
+
+void report(const std::string &name, unsigned long long graphs, double seconds)
+{
+    std::cout << name << "," << graphs << "," << seconds << "," << graphs / seconds << std::endl;
+}
+
+template<typename Read>
+void measure(const std::string &name, const std::string &input, const Read &read)
+{
+    std::istringstream in(input);
+    auto start = Clock::now();
+    auto graphs = read(in);
+    report(name, graphs, std::chrono::duration<double>(Clock::now() - start).count());
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc > 1 && std::string(argv[1]) == "-h") {
+        std::cout << "Usage: " << argv[0] << " [numGraphs [numVertices [density]]]" << std::endl;
+        return 0;
+    }
+    auto numGraphs = argc > 1 ? std::stoull(argv[1]) : 1000000ULL;
+    auto n = argc > 2 ? static_cast<unsigned int>(std::stoul(argv[2])) : 12U;
+    auto density = argc > 3 ? std::stod(argv[3]) : 0.2;
+
+    std::cerr << "Generating " << numGraphs << " graphs with " << n << " vertices..." << std::endl;
+    Collections c = generate(numGraphs, n, density);
+
+    auto countArcs = [](unsigned long long &arcs) {
+        return [&arcs](DiGraph *graph) {
+            arcs += graph->getNumArcs(true);
+            return true;
+        };
+    };
+
+    std::cout << "benchmark,graphs,seconds,graphs_per_second" << std::endl;
+    measure("sparse6_fresh_graph", c.sparseSix, [](std::istream &in) {
+        SparseSixGraphRW reader;
+        reader.setInputStream(&in);
+        auto graphs = 0ULL;
+        while (reader.isGraphAvailable()) {
+            IncidenceListGraph graph;
+            reader.provideDiGraph(&graph);
+            graphs++;
+        }
+        return graphs;
+    });
+    for (auto input : { std::make_pair("sparse6", &c.sparseSix),
+                        std::make_pair("graph6", &c.graphSix),
+                        std::make_pair("digraph6", &c.digraphSix) }) {
+        measure(std::string(input.first) + "_reused_graph", *input.second, [&](std::istream &in) {
+            NautyFormatReader reader(&in);
+            IncidenceListGraph graph;
+            auto arcs = 0ULL;
+            auto graphs = reader.mapGraphs(&graph, countArcs(arcs));
+            if (!reader.getLastError().empty()) {
+                std::cerr << reader.getLastError() << std::endl;
+            }
+            return graphs;
+        });
+    }
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "graph.incidencelist/incidencelistgraph.h"
+#include "observable.h"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace Algora;
+
+typedef std::chrono::steady_clock Clock;
+
+double secondsSince(const Clock::time_point &start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+void report(const std::string &what, unsigned int observers, unsigned long long notifications, double seconds) {
+    std::cout << what << "," << observers << "," << notifications << "," << seconds
+              << "," << (seconds > 0.0 ? notifications / seconds : 0.0) << std::endl;
+}
+
+void benchmarkGraphMutation(unsigned int numObservers, unsigned long long n) {
+    IncidenceListGraph g;
+    g.reserveVertexCapacity(n);
+    g.reserveArcCapacity(n);
+    std::vector<unsigned long long> counters(numObservers, 0ULL);
+    for (auto &c : counters) {
+        g.onVertexAdd(&c, [&c](Vertex *) { c++; });
+        g.onArcAdd(&c, [&c](Arc *) { c++; });
+        g.onArcRemove(&c, [&c](Arc *) { c++; });
+    }
+
+    auto start = Clock::now();
+    std::vector<Vertex*> vertices;
+    vertices.reserve(n);
+    for (auto i = 0ULL; i < n; i++) {
+        vertices.push_back(g.addVertex());
+    }
+    std::vector<Arc*> arcs;
+    arcs.reserve(n);
+    for (auto i = 0ULL; i < n; i++) {
+        arcs.push_back(g.addArc(vertices[i], vertices[(i * 7919ULL + 1ULL) % n]));
+    }
+    for (auto *a : arcs) {
+        g.removeArc(a);
+    }
+    auto seconds = secondsSince(start);
+    // report mutations per second as notifications are zero without observers
+    report("graph_mutation", numObservers, 3ULL * n, seconds);
+}
+
+void benchmarkDispatch(unsigned int numObservers, unsigned long long n) {
+    std::vector<unsigned long long> counters(numObservers, 0ULL);
+    Vertex v;
+
+    Observable<Vertex*> functions;
+    for (auto &c : counters) {
+        functions.addObserver(&c, [&c](Vertex *) { c++; });
+    }
+    auto start = Clock::now();
+    for (auto i = 0ULL; i < n; i++) {
+        functions.notifyObservers(&v);
+    }
+    report("dispatch_function", numObservers, n * numObservers, secondsSince(start));
+}
+
+void benchmarkStaticDispatch(unsigned long long n) {
+    // volatile, so that the compiler cannot fold the loops
+    volatile unsigned long long c1 = 0ULL, c8[8] = { };
+    Vertex v;
+
+    auto one = makeStaticObservable([&c1](Vertex *) { c1++; });
+    auto start = Clock::now();
+    for (auto i = 0ULL; i < n; i++) {
+        one.notifyObservers(&v);
+    }
+    report("dispatch_static", 1, n, secondsSince(start));
+
+    auto eight = makeStaticObservable(
+                [&c8](Vertex *) { c8[0]++; }, [&c8](Vertex *) { c8[1]++; },
+                [&c8](Vertex *) { c8[2]++; }, [&c8](Vertex *) { c8[3]++; },
+                [&c8](Vertex *) { c8[4]++; }, [&c8](Vertex *) { c8[5]++; },
+                [&c8](Vertex *) { c8[6]++; }, [&c8](Vertex *) { c8[7]++; });
+    start = Clock::now();
+    for (auto i = 0ULL; i < n; i++) {
+        eight.notifyObservers(&v);
+    }
+    report("dispatch_static", 8, 8ULL * n, secondsSince(start));
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned long long n = argc > 1 ? std::stoull(argv[1]) : 1000000ULL;
+
+    std::cout << "benchmark,observers,notifications,seconds,per_second" << std::endl;
+    for (auto k : { 0U, 1U, 8U }) {
+        benchmarkGraphMutation(k, n);
+    }
+    for (auto k : { 0U, 1U, 8U }) {
+        benchmarkDispatch(k, 10ULL * n);
+    }
+    benchmarkStaticDispatch(10ULL * n);
+
+    return 0;
+}
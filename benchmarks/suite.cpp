@@ -0,0 +1,695 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "graph.incidencelist/incidencelistgraph.h"
+#include "property/propertymap.h"
+#include "property/fastpropertymap.h"
+#include "algorithm.basic.traversal/breadthfirstsearch.h"
+#include "algorithm.basic.traversal/depthfirstsearch.h"
+#include "algorithm.basic/tarjansccalgorithm.h"
+#include "algorithm.basic/parallelsccalgorithm.h"
+#include "algorithm.basic/topsortalgorithm.h"
+#include "algorithm.basic/finddipathalgorithm.h"
+#include "io/adjacencyliststringreader.h"
+#include "io/adjacencyliststringwriter.h"
+#include "io/parallellistreader.h"
+#include "io/sparsesixgraphrw.h"
+#include "io/adjacencymatrixrw.h"
+#include "io/binarygraphrw.h"
+#include "io/snapedgelistrw.h"
+#include "io/metisgraphrw.h"
+#include "io/dimacsgraphrw.h"
+#include "io/matrixmarketrw.h"
+#include "graph.snapshot/digraphsnapshotpublisher.h"
+#include "parallel/parallelmap.h"
+
+#include <pthread.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace Algora;
+
+typedef std::chrono::steady_clock Clock;
+typedef std::vector<std::pair<unsigned long long, unsigned long long>> ArcList;
+
+struct Options {
+    unsigned long long numVertices = 100000ULL;
+    unsigned long long degree = 4ULL;
+    unsigned int repetitions = 3U;
+    unsigned long long numQueries = 100ULL;
+    unsigned long long seed = 42ULL;
+    unsigned long long maxMatrixVertices = 5000ULL;
+    unsigned long long stackMiB = 1024ULL;
+    bool json = false;
+    std::string filter;
+};
+
+// Collects one record per benchmark run and prints it as CSV line or JSON
+// object, so that results can be tracked across releases.
+class Reporter
+{
+public:
+    explicit Reporter(const Options &opts) : opts(opts), first(true) { }
+
+    void begin() {
+        if (opts.json) {
+            std::cout << "[" << std::endl;
+        } else {
+            std::cout << "benchmark,vertices,arcs,repetition,seconds,operations,operations_per_second"
+                      << std::endl;
+        }
+    }
+
+    void report(const std::string &name, unsigned int rep, unsigned long long vertices,
+                unsigned long long arcs, double seconds, unsigned long long ops) {
+        double rate = seconds > 0.0 ? ops / seconds : 0.0;
+        if (opts.json) {
+            std::cout << (first ? "  " : ", ")
+                      << "{\"benchmark\": \"" << name << "\", \"vertices\": " << vertices
+                      << ", \"arcs\": " << arcs << ", \"repetition\": " << rep
+                      << ", \"seconds\": " << seconds << ", \"operations\": " << ops
+                      << ", \"operations_per_second\": " << rate << "}" << std::endl;
+        } else {
+            std::cout << name << "," << vertices << "," << arcs << "," << rep << ","
+                      << seconds << "," << ops << "," << rate << std::endl;
+        }
+        first = false;
+    }
+
+    void end() {
+        if (opts.json) {
+            std::cout << "]" << std::endl;
+        }
+    }
+
+private:
+    const Options &opts;
+    bool first;
+};
+
+class Suite
+{
+public:
+    explicit Suite(const Options &opts) : opts(opts), reporter(opts) { }
+
+    void run();
+
+private:
+    const Options &opts;
+    Reporter reporter;
+    ArcList arcs;
+    ArcList dagArcs;
+    IncidenceListGraph graph;
+    IncidenceListGraph dag;
+    std::vector<Vertex*> vertices;
+
+    bool selected(const std::string &name) const {
+        return opts.filter.empty() || name.find(opts.filter) != std::string::npos;
+    }
+
+    // runs prepare() (untimed, if any), then fun() once per repetition;
+    // fun returns the number of operations performed
+    bool measure(const std::string &name, const DiGraph &g,
+                 const std::function<void()> &prepare,
+                 const std::function<unsigned long long()> &fun) {
+        if (!selected(name)) {
+            return false;
+        }
+        for (auto rep = 0U; rep < opts.repetitions; rep++) {
+            if (prepare) {
+                prepare();
+            }
+            auto start = Clock::now();
+            auto ops = fun();
+            double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+            reporter.report(name, rep, g.getSize(), g.getNumArcs(true), seconds, ops);
+        }
+        return true;
+    }
+
+    void generate();
+    static void build(IncidenceListGraph &g, std::vector<Vertex*> &vs,
+                      unsigned long long n, const ArcList &arcList, bool reserve);
+
+    void benchmarkConstruction();
+    void benchmarkChurn();
+    void benchmarkFindArc();
+    void benchmarkProperties();
+    void benchmarkAlgorithms();
+    void benchmarkIO();
+    void benchmarkSnapshots();
+    void benchmarkParallelMapping();
+
+    template<typename Writer, typename Reader>
+    void benchmarkFormat(const std::string &format, Writer &writer, Reader &reader);
+};
+
+void Suite::generate()
+{
+    std::mt19937_64 rnd(opts.seed);
+    std::uniform_int_distribution<unsigned long long> dist(0ULL, opts.numVertices - 1ULL);
+    auto m = opts.numVertices * opts.degree;
+    arcs.reserve(m);
+    dagArcs.reserve(m);
+    for (auto i = 0ULL; i < m; i++) {
+        auto tail = dist(rnd);
+        auto head = dist(rnd);
+        arcs.emplace_back(tail, head);
+        if (tail != head) {
+            dagArcs.emplace_back(std::min(tail, head), std::max(tail, head));
+        }
+    }
+    build(graph, vertices, opts.numVertices, arcs, true);
+    std::vector<Vertex*> dagVertices;
+    build(dag, dagVertices, opts.numVertices, dagArcs, true);
+}
+
+void Suite::build(IncidenceListGraph &g, std::vector<Vertex*> &vs,
+                  unsigned long long n, const ArcList &arcList, bool reserve)
+{
+    g.clear();
+    vs.clear();
+    vs.reserve(n);
+    if (reserve) {
+        g.reserveVertexCapacity(n);
+        g.reserveArcCapacity(arcList.size());
+    }
+    for (auto i = 0ULL; i < n; i++) {
+        vs.push_back(g.addVertex());
+    }
+    for (const auto &a : arcList) {
+        g.addArc(vs[a.first], vs[a.second]);
+    }
+}
+
+void Suite::benchmarkConstruction()
+{
+    IncidenceListGraph g;
+    std::vector<Vertex*> vs;
+    auto ops = opts.numVertices + arcs.size();
+    measure("construct", g, [&]() { g.clear(); },
+            [&]() { build(g, vs, opts.numVertices, arcs, false); return ops; });
+    measure("construct_reserved", g, [&]() { g.clear(); },
+            [&]() { build(g, vs, opts.numVertices, arcs, true); return ops; });
+
+    IncidenceListGraph copy;
+    measure("copy", copy, [&]() { copy.clearAndRelease(); },
+            [&]() { copy = graph; return ops; });
+    measure("copy_parallel", copy, [&]() { copy.clearAndRelease(); },
+            [&]() { copy.assignParallel(graph); return ops; });
+}
+
+void Suite::benchmarkChurn()
+{
+    IncidenceListGraph g;
+    std::vector<Vertex*> vs;
+    std::vector<Arc*> arcObjects;
+    std::mt19937_64 rnd(opts.seed + 1ULL);
+    auto rebuild = [&]() {
+        build(g, vs, opts.numVertices, arcs, true);
+        arcObjects.clear();
+        g.mapArcs([&arcObjects](Arc *a) { arcObjects.push_back(a); });
+        std::shuffle(arcObjects.begin(), arcObjects.end(), rnd);
+    };
+
+    // remove half of all arcs in random order, then add them again
+    measure("churn_arcs", g, rebuild, [&]() {
+        auto k = arcObjects.size() / 2;
+        ArcList removed;
+        removed.reserve(k);
+        for (auto i = 0ULL; i < k; i++) {
+            auto *a = arcObjects[i];
+            removed.emplace_back(a->getTail()->getId(), a->getHead()->getId());
+            g.removeArc(a);
+        }
+        for (const auto &a : removed) {
+            g.addArc(vs[a.first], vs[a.second]);
+        }
+        return 2ULL * k;
+    });
+
+    // remove a tenth of all vertices in random order, then add them again
+    measure("churn_vertices", g, [&]() { rebuild(); std::shuffle(vs.begin(), vs.end(), rnd); },
+            [&]() {
+        auto k = vs.size() / 10;
+        for (auto i = 0ULL; i < k; i++) {
+            g.removeVertex(vs[i]);
+        }
+        for (auto i = 0ULL; i < k; i++) {
+            g.addVertex();
+        }
+        return 2ULL * k;
+    });
+}
+
+void Suite::benchmarkFindArc()
+{
+    std::mt19937_64 rnd(opts.seed + 2ULL);
+    std::uniform_int_distribution<unsigned long long> dist(0ULL, opts.numVertices - 1ULL);
+    ArcList queries;
+    queries.reserve(arcs.size());
+    for (auto i = 0ULL; i < arcs.size(); i++) {
+        // every other query hits an existing arc
+        queries.emplace_back(i % 2 ? arcs[i] : std::make_pair(dist(rnd), dist(rnd)));
+    }
+    unsigned long long found = 0ULL;
+    bool ran = measure("find_arc", graph, nullptr, [&]() {
+        for (const auto &q : queries) {
+            if (graph.findArc(vertices[q.first], vertices[q.second])) {
+                found++;
+            }
+        }
+        return queries.size();
+    });
+    if (ran) {
+        std::cerr << "find_arc: " << found << " hits" << std::endl;
+    }
+}
+
+template<template<typename T> class PropertyType>
+void benchmarkProperty(DiGraph &graph, const std::string &prefix,
+                       const std::function<bool(const std::string &,
+                                                const std::function<unsigned long long()> &)> &measure)
+{
+    PropertyType<unsigned long long> vertexProperty;
+    PropertyType<unsigned long long> arcProperty;
+    unsigned long long sum = 0ULL;
+    bool ran = false;
+    ran |= measure(prefix + "_vertex_set", [&]() {
+        unsigned long long i = 0ULL;
+        graph.mapVertices([&](Vertex *v) { vertexProperty.setValue(v, i++); });
+        return i;
+    });
+    ran |= measure(prefix + "_vertex_get", [&]() {
+        unsigned long long i = 0ULL;
+        graph.mapVertices([&](Vertex *v) { sum += vertexProperty.getValue(v); i++; });
+        return i;
+    });
+    ran |= measure(prefix + "_arc_set", [&]() {
+        unsigned long long i = 0ULL;
+        graph.mapArcs([&](Arc *a) { arcProperty.setValue(a, i++); });
+        return i;
+    });
+    ran |= measure(prefix + "_arc_get", [&]() {
+        unsigned long long i = 0ULL;
+        graph.mapArcs([&](Arc *a) { sum += arcProperty.getValue(a); i++; });
+        return i;
+    });
+    if (ran) {
+        std::cerr << prefix << ": checksum " << sum << std::endl;
+    }
+}
+
+void Suite::benchmarkProperties()
+{
+    auto m = [this](const std::string &name, const std::function<unsigned long long()> &fun) {
+        return measure(name, graph, nullptr, fun);
+    };
+    benchmarkProperty<PropertyMap>(graph, "propertymap", m);
+    benchmarkProperty<FastPropertyMap>(graph, "fastpropertymap", m);
+}
+
+void Suite::benchmarkAlgorithms()
+{
+    auto m = graph.getNumArcs(true);
+    auto n = graph.getSize();
+
+    BreadthFirstSearch<FastPropertyMap> bfs;
+    FastPropertyMap<DiGraph::size_type> bfsNumbers;
+    bfs.setGraph(&graph);
+    bfs.useModifiableProperty(&bfsNumbers);
+    measure("bfs", graph, nullptr, [&]() {
+        bfs.setStartVertex(vertices.front());
+        bfs.prepare();
+        bfs.run();
+        bfs.deliver();
+        return n + m;
+    });
+
+    DepthFirstSearch<FastPropertyMap> dfs;
+    FastPropertyMap<DFSResult> dfsResults;
+    dfs.setGraph(&graph);
+    dfs.useModifiableProperty(&dfsResults);
+    measure("dfs", graph, nullptr, [&]() {
+        dfs.setStartVertex(vertices.front());
+        dfs.prepare();
+        dfs.run();
+        dfs.deliver();
+        return n + m;
+    });
+
+    TarjanSCCAlgorithm<FastPropertyMap> tarjan;
+    FastPropertyMap<DiGraph::size_type> sccs;
+    tarjan.setGraph(&graph);
+    tarjan.useModifiableProperty(&sccs);
+    measure("tarjan_scc", graph, nullptr, [&]() {
+        tarjan.prepare();
+        tarjan.run();
+        tarjan.deliver();
+        return n + m;
+    });
+
+    ParallelSCCAlgorithm parallelScc;
+    FastPropertyMap<DiGraph::size_type> parallelSccs;
+    parallelScc.setGraph(&graph);
+    parallelScc.useModifiableProperty(&parallelSccs);
+    bool ran = measure("parallel_scc", graph, nullptr, [&]() {
+        parallelScc.prepare();
+        parallelScc.run();
+        return n + m;
+    });
+    if (ran) {
+        std::cerr << "parallel_scc: " << parallelScc.deliver() << " components" << std::endl;
+    }
+
+    TopSortAlgorithm topSort(false);
+    topSort.setGraph(&dag);
+    measure("topsort", dag, nullptr, [&]() {
+        topSort.prepare();
+        topSort.run();
+        topSort.deliver();
+        return dag.getSize() + dag.getNumArcs(true);
+    });
+
+    std::mt19937_64 rnd(opts.seed + 3ULL);
+    std::uniform_int_distribution<unsigned long long> dist(0ULL, opts.numVertices - 1ULL);
+    ArcList queries;
+    for (auto i = 0ULL; i < opts.numQueries; i++) {
+        queries.emplace_back(dist(rnd), dist(rnd));
+    }
+    for (bool twoWay : { false, true }) {
+        FindDiPathAlgorithm<FastPropertyMap> findPath(false, true, twoWay);
+        findPath.setGraph(&graph);
+        unsigned long long pathsFound = 0ULL;
+        bool ran = measure(twoWay ? "finddipath_twoway" : "finddipath_oneway", graph, nullptr, [&]() {
+            for (const auto &q : queries) {
+                findPath.setSourceAndTarget(vertices[q.first], vertices[q.second]);
+                findPath.prepare();
+                findPath.run();
+                if (findPath.deliver()) {
+                    pathsFound++;
+                }
+            }
+            return queries.size();
+        });
+        if (ran) {
+            std::cerr << (twoWay ? "finddipath_twoway: " : "finddipath_oneway: ")
+                      << pathsFound << " paths found" << std::endl;
+        }
+    }
+}
+
+template<typename Writer, typename Reader>
+void Suite::benchmarkFormat(const std::string &format, Writer &writer, Reader &reader)
+{
+    std::string data;
+    measure("write_" + format, graph, nullptr, [&]() {
+        std::ostringstream out;
+        writer.setOutputStream(&out);
+        writer.processGraph(&graph);
+        data = out.str();
+        return data.size();
+    });
+    if (data.empty()) {
+        std::ostringstream out;
+        writer.setOutputStream(&out);
+        writer.processGraph(&graph);
+        data = out.str();
+    }
+    IncidenceListGraph copy;
+    measure("read_" + format, copy, [&]() { copy.clear(); }, [&]() {
+        std::istringstream in(data);
+        reader.setInputStream(&in);
+        if (!reader.provideDiGraph(&copy)) {
+            std::cerr << "Could not read " << format << " data." << std::endl;
+        }
+        return data.size();
+    });
+}
+
+void Suite::benchmarkIO()
+{
+    AdjacencyListStringWriter listWriter;
+    AdjacencyListStringReader listReader;
+    benchmarkFormat("adjacencylist", listWriter, listReader);
+
+    if (selected("read_adjacencylist_in_place")) {
+        std::ostringstream out;
+        listWriter.setOutputStream(&out);
+        listWriter.processGraph(&graph);
+        std::string data = out.str();
+        IncidenceListGraph copy;
+        measure("read_adjacencylist_in_place", copy, [&]() { copy.clear(); }, [&]() {
+            listReader.setInput(data.data(), data.data() + data.size());
+            listReader.provideDiGraph(&copy);
+            return data.size();
+        });
+    }
+
+    if (selected("read_adjacencylist_parallel")) {
+        std::ostringstream out;
+        listWriter.setOutputStream(&out);
+        listWriter.processGraph(&graph);
+        std::string data = out.str();
+        ParallelListReader parallelReader;
+        IncidenceListGraph copy;
+        measure("read_adjacencylist_parallel", copy, [&]() { copy.clear(); }, [&]() {
+            parallelReader.setInput(data.data(), data.data() + data.size());
+            parallelReader.provideDiGraph(&copy);
+            return data.size();
+        });
+    }
+
+    SparseSixGraphRW sparseSix;
+    benchmarkFormat("sparse6", sparseSix, sparseSix);
+
+    if (opts.numVertices <= opts.maxMatrixVertices) {
+        AdjacencyMatrixRW matrix(true);
+        benchmarkFormat("adjacencymatrix", matrix, matrix);
+        AdjacencyMatrixRW packedMatrix(true, false, false, true);
+        benchmarkFormat("adjacencymatrix_packed", packedMatrix, packedMatrix);
+    } else if (selected("adjacencymatrix")) {
+        std::cerr << "Skipping adjacency matrix formats, graph has more than "
+                  << opts.maxMatrixVertices << " vertices." << std::endl;
+    }
+
+    BinaryGraphRW binary;
+    benchmarkFormat("binary", binary, binary);
+    SnapEdgeListRW snap;
+    benchmarkFormat("snap", snap, snap);
+    MetisGraphRW metis;
+    benchmarkFormat("metis", metis, metis);
+    DimacsGraphRW dimacs;
+    benchmarkFormat("dimacs", dimacs, dimacs);
+    MatrixMarketRW matrixMarket;
+    benchmarkFormat("matrixmarket", matrixMarket, matrixMarket);
+}
+
+void Suite::benchmarkSnapshots()
+{
+    IncidenceListGraph g;
+    std::vector<Vertex*> vs;
+    build(g, vs, opts.numVertices, arcs, true);
+    DiGraphSnapshotPublisher publisher(g, true);
+
+    measure("snapshot_publish_full", g, [&]() { publisher.invalidateAll(); }, [&]() {
+        publisher.publish();
+        return g.getSize() + g.getNumArcs(true);
+    });
+
+    // replace a few arcs between the first vertices, so that only few blocks change
+    std::mt19937_64 rnd(opts.seed + 2ULL);
+    auto local = std::min<unsigned long long>(vs.size(), DiGraphSnapshot::BLOCK_SIZE);
+    const unsigned long long changes = 100ULL;
+    std::shared_ptr<const DiGraphSnapshot> previous;
+    bool ran = measure("snapshot_publish_local", g, [&]() {
+        previous = publisher.publish();
+        for (auto i = 0ULL; i < changes; i++) {
+            Vertex *tail = vs[rnd() % local];
+            auto *a = g.findArc(tail, vs[rnd() % local]);
+            if (a != nullptr) {
+                g.removeArc(a);
+            }
+            g.addArc(tail, vs[rnd() % local]);
+        }
+    }, [&]() {
+        publisher.publish();
+        return changes;
+    });
+    if (ran) {
+        auto snapshot = publisher.getSnapshot();
+        std::cerr << "Snapshot memory: " << snapshot->memoryUsage().reserved << " bytes in total, "
+                  << snapshot->memoryUsage(previous.get()).reserved << " bytes not shared with its predecessor ("
+                  << snapshot->getNumSharedBlocks(*previous) << " shared blocks)." << std::endl;
+    }
+
+    auto snapshot = publisher.publish();
+    measure("snapshot_traverse", g, nullptr, [&]() {
+        unsigned long long visited = 0ULL;
+        snapshot->mapVertices([&](DiGraphSnapshot::id_type v) {
+            snapshot->mapOutgoingArcs(v, [&](DiGraphSnapshot::id_type, DiGraphSnapshot::id_type) {
+                visited++;
+            });
+        });
+        return visited;
+    });
+}
+
+void Suite::benchmarkParallelMapping()
+{
+    auto headId = [](Arc *a) { return a->getHead()->getId(); };
+    auto plus = [](unsigned long long x, unsigned long long y) { return x + y; };
+    auto m = graph.getNumArcs(true);
+    unsigned long long serialSum = 0ULL, parallelSum = 0ULL;
+    measure("map_arcs_serial", graph, nullptr, [&]() {
+        serialSum = 0ULL;
+        graph.mapArcs([&](Arc *a) { serialSum += headId(a); });
+        return m;
+    });
+    bool ran = measure("map_arcs_parallel_reduce", graph, nullptr, [&]() {
+        parallelSum = parallelReduceArcs(graph, 0ULL, headId, plus);
+        return m;
+    });
+    auto ranges = partitionVerticesByDegree(graph);
+    measure("map_vertices_parallel_partition", graph, nullptr, [&]() {
+        partitionVerticesByDegree(graph);
+        return graph.getSize();
+    });
+    measure("map_arcs_parallel_reduce_ranges", graph, nullptr, [&]() {
+        parallelSum = parallelReduceArcs(graph, ranges, 0ULL, headId, plus);
+        return m;
+    });
+    if (ran) {
+        std::cerr << "Parallel mapping: " << WorkStealingPool::getDefault().getNumThreads()
+                  << " threads, " << ranges.size() - 1U << " vertex ranges"
+                  << (serialSum == parallelSum || serialSum == 0ULL ? "" : ", SUMS DIFFER") << "." << std::endl;
+    }
+
+    FastPropertyMap<DiGraph::size_type> outDegrees;
+    measure("map_vertices_parallel", graph, [&]() { outDegrees.resetAll(graph.getSize()); }, [&]() {
+        parallelMapVertices(graph, [&](Vertex *v) {
+            outDegrees.setValueAtId(v->getId(), graph.getOutDegree(v, true));
+        });
+        return graph.getSize();
+    });
+}
+
+void Suite::run()
+{
+    std::cerr << "Generating graphs with " << opts.numVertices << " vertices and "
+              << opts.numVertices * opts.degree << " arcs..." << std::endl;
+    generate();
+
+    reporter.begin();
+    benchmarkConstruction();
+    benchmarkChurn();
+    benchmarkFindArc();
+    benchmarkProperties();
+    benchmarkAlgorithms();
+    benchmarkIO();
+    benchmarkSnapshots();
+    benchmarkParallelMapping();
+    reporter.end();
+}
+
+// DepthFirstSearch and TarjanSCCAlgorithm recurse once per vertex on a path,
+// so the suite runs on a thread with a large (lazily committed) stack
+void *runSuite(void *opts)
+{
+    Suite suite(*static_cast<Options*>(opts));
+    suite.run();
+    return nullptr;
+}
+
+void usage(const char *name)
+{
+    std::cout << "Usage: " << name << " [options]\n"
+              << "  -n <vertices>     number of vertices (default: 100000)\n"
+              << "  -d <degree>       average out-degree (default: 4)\n"
+              << "  -r <repetitions>  runs per benchmark (default: 3)\n"
+              << "  -q <queries>      path queries per run (default: 100)\n"
+              << "  -s <seed>         random seed (default: 42)\n"
+              << "  -m <vertices>     largest graph written as adjacency matrix (default: 5000)\n"
+              << "  -S <MiB>          stack size for recursive DFS and Tarjan SCC (default: 1024)\n"
+              << "  -b <substring>    run only benchmarks whose name contains <substring>\n"
+              << "  -j                print JSON instead of CSV\n"
+              << "  -h                show this help" << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    Options opts;
+    for (int i = 1; i < argc; i++) {
+        std::string arg(argv[i]);
+        if (arg == "-h") {
+            usage(argv[0]);
+            return 0;
+        } else if (arg == "-j") {
+            opts.json = true;
+        } else if (i + 1 < argc && arg == "-n") {
+            opts.numVertices = std::stoull(argv[++i]);
+        } else if (i + 1 < argc && arg == "-d") {
+            opts.degree = std::stoull(argv[++i]);
+        } else if (i + 1 < argc && arg == "-r") {
+            opts.repetitions = static_cast<unsigned int>(std::stoul(argv[++i]));
+        } else if (i + 1 < argc && arg == "-q") {
+            opts.numQueries = std::stoull(argv[++i]);
+        } else if (i + 1 < argc && arg == "-s") {
+            opts.seed = std::stoull(argv[++i]);
+        } else if (i + 1 < argc && arg == "-m") {
+            opts.maxMatrixVertices = std::stoull(argv[++i]);
+        } else if (i + 1 < argc && arg == "-S") {
+            opts.stackMiB = std::stoull(argv[++i]);
+        } else if (i + 1 < argc && arg == "-b") {
+            opts.filter = argv[++i];
+        } else {
+            std::cerr << "Unknown option " << arg << ". Run " << argv[0] << " -h for help." << std::endl;
+            return 1;
+        }
+    }
+    if (opts.numVertices == 0ULL) {
+        std::cerr << "Number of vertices must be positive." << std::endl;
+        return 1;
+    }
+
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, opts.stackMiB << 20U);
+    pthread_t thread;
+    if (pthread_create(&thread, &attr, runSuite, &opts) != 0) {
+        std::cerr << "Could not start benchmark thread with a stack of "
+                  << opts.stackMiB << " MiB." << std::endl;
+        return 1;
+    }
+    pthread_join(thread, nullptr);
+    pthread_attr_destroy(&attr);
+
+    return 0;
+}
@@ -41,6 +41,9 @@ QMAKE_EXTRA_TARGETS += acinfotarget
 
 QMAKE_CXXFLAGS_DEBUG += -std=c++17 -O0
 
+QMAKE_CXXFLAGS += -pthread
+QMAKE_LFLAGS += -pthread
+
 QMAKE_CXXFLAGS_STATIC_LIB = # remove -fPIC
 QMAKE_CXXFLAGS_RELEASE -= -O1 -O2 -O3
 QMAKE_CXXFLAGS_RELEASE += -std=c++17 -DNDEBUG -flto
@@ -61,6 +64,13 @@ debugsymbols {
 	QMAKE_CXXFLAGS_RELEASE += -fno-omit-frame-pointer -g
 }
 
+# per-algorithm counters, see algorithm/algorithmprofile.h;
+# code using the library should define ALGORA_PROFILING as well,
+# header-only algorithms only count if it does
+profiling {
+	DEFINES += ALGORA_PROFILING
+}
+
 unix {
     target.path = /usr/lib
     INSTALLS += target
@@ -68,6 +78,7 @@ unix {
 
 HEADERS += \
     $$PWD/algoracore_info.h \
+    memoryusage.h \
     observable.h
 
 SOURCES += \
@@ -75,6 +86,10 @@ SOURCES += \
 
 include(graph/graph.pri)
 include(graph.incidencelist/graph.incidencelist.pri)
+include(graph.csr/graph.csr.pri)
+include(graph.generator/graph.generator.pri)
+include(graph.snapshot/graph.snapshot.pri)
+include(parallel/parallel.pri)
 include(graph.visitor/graph.visitor.pri)
 include(property/property.pri)
 include(pipe/pipe.pri)
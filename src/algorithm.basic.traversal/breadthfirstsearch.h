@@ -129,44 +129,16 @@ public:
             this->startVertex = this->diGraph->getAnyVertex();
         }
 
-        maxBfsNumber = 0ULL;
-        maxLevel = 0ULL;
-
-        queue.clear();
-        queue.set_capacity(this->diGraph->getSize());
-        discovered.resetAll();
-        exhausted = false;
-
-        if (startVertices.empty()) {
-            if (!this->onVertexDiscovered(this->startVertex)) {
-                return;
-            }
-            queue.push_back(this->startVertex);
-            queue.push_back(nullptr);
-            discovered.setValue(this->startVertex, true);
-            if (valueComputation && this->computePropertyValues) {
-                this->property->setValue(this->startVertex, 0);
-            }
-        } else {
-            for (auto *v : startVertices) {
-                if (!this->onVertexDiscovered(v)) {
-                    continue;
-                }
-                queue.push_back(v);
-                discovered.setValue(v, true);
-                if (valueComputation && this->computePropertyValues) {
-                    int c = computeOrder ? maxBfsNumber : 0;
-                    this->property->setValue(v, c);
-                }
-                maxBfsNumber++;
-            }
-            if (queue.empty()) {
-                return;
-            }
-            queue.push_back(nullptr);
-            maxBfsNumber--;
+        this->profile.reset();
+        resizesBefore = AlgorithmProfile::numResizes(&discovered, this->property);
+        bool started;
+        {
+            AlgorithmProfile::Phase phase(this->profile, "initialize");
+            started = initialize();
+        }
+        if (started) {
+            resume();
         }
-        resume();
     }
 
     virtual void resume()
@@ -178,6 +150,7 @@ public:
         };
         const auto &getPeer = ignoreArcDirection ? getOtherEndVertex
                                                 : (reverseArcDirection ? getTail : getHead);
+        AlgorithmProfile::Phase phase(this->profile, "search");
         bool stop = false;
 
         while (!stop && !this->queue.empty()) {
@@ -189,6 +162,7 @@ public:
                     break;
                 }
                 this->queue.pop_front();
+                this->profile.add(AlgorithmProfile::VerticesVisited);
             } else {
                 this->queue.pop_front();
                 if (!this->queue.empty()) {
@@ -199,6 +173,7 @@ public:
             }
 
             auto arcMapping = [this,curr,&stop,&getPeer](Arc *a) {
+                this->profile.add(AlgorithmProfile::ArcsScanned);
                 bool consider = this->onArcDiscovered(a);
                 if (!consider) {
                     return;
@@ -237,10 +212,14 @@ public:
                 this->diGraph->mapOutgoingArcsUntil(curr, arcMapping, arcStopCondition);
             }
 
+            this->profile.peak(AlgorithmProfile::QueuePeakSize, this->queue.size());
+
             if (stopAfterEachNeighborsScan) {
                 stop = true;
             }
         }
+        this->profile.set(AlgorithmProfile::PropertyMapResizes,
+                          AlgorithmProfile::numResizes(&discovered, this->property) - resizesBefore);
         if (!stop) {
             assert(this->queue.empty());
         }
@@ -273,11 +252,55 @@ private:
         maxBfsNumber = INF;
         maxLevel = INF;
     }
+    // sets up queue and start vertices, false if there is nothing to search
+    bool initialize()
+    {
+        maxBfsNumber = 0ULL;
+        maxLevel = 0ULL;
+
+        queue.clear();
+        queue.set_capacity(this->diGraph->getSize());
+        discovered.resetAll();
+        exhausted = false;
+
+        if (startVertices.empty()) {
+            if (!this->onVertexDiscovered(this->startVertex)) {
+                return false;
+            }
+            queue.push_back(this->startVertex);
+            queue.push_back(nullptr);
+            discovered.setValue(this->startVertex, true);
+            if (valueComputation && this->computePropertyValues) {
+                this->property->setValue(this->startVertex, 0);
+            }
+        } else {
+            for (auto *v : startVertices) {
+                if (!this->onVertexDiscovered(v)) {
+                    continue;
+                }
+                queue.push_back(v);
+                discovered.setValue(v, true);
+                if (valueComputation && this->computePropertyValues) {
+                    int c = computeOrder ? maxBfsNumber : 0;
+                    this->property->setValue(v, c);
+                }
+                maxBfsNumber++;
+            }
+            if (queue.empty()) {
+                return false;
+            }
+            queue.push_back(nullptr);
+            maxBfsNumber--;
+        }
+        return true;
+    }
+
     ModifiablePropertyType<bool> discovered;
     boost::circular_buffer<const Vertex*> queue;
     std::vector<const Vertex*> startVertices;
     bool exhausted;
     bool stopAfterEachNeighborsScan;
+    AlgorithmProfile::counter_type resizesBefore = 0U;
 };
 
 }
@@ -93,9 +93,15 @@ public:
 
 				DiGraph::size_type nextDepth = 0;
         bool stop = false;
+        this->profile.reset();
+        auto resizesBefore = AlgorithmProfile::numResizes(&discovered, this->property);
+        AlgorithmProfile::Phase phase(this->profile, "search");
         discovered.resetAll();
+        recursionDepth = 0U;
         dfs(source, nextDepth, stop);
         verticesReached = nextDepth;
+        this->profile.set(AlgorithmProfile::PropertyMapResizes,
+                          AlgorithmProfile::numResizes(&discovered, this->property) - resizesBefore);
     }
 
     virtual std::string getName() const noexcept override { return "DFS"; }
@@ -117,8 +123,20 @@ private:
     ArcMapping treeArc;
     ArcMapping nonTreeArc;
     ModifiablePropertyType<bool> discovered;
+    AlgorithmProfile::counter_type recursionDepth = 0U;
 
     void dfs(const Vertex *v, DiGraph::size_type &depth, bool &stop) {
+        if constexpr (AlgorithmProfile::enabled) {
+            this->profile.add(AlgorithmProfile::VerticesVisited);
+            this->profile.peak(AlgorithmProfile::QueuePeakSize, ++recursionDepth);
+        }
+        dfsVisit(v, depth, stop);
+        if constexpr (AlgorithmProfile::enabled) {
+            recursionDepth--;
+        }
+    }
+
+    void dfsVisit(const Vertex *v, DiGraph::size_type &depth, bool &stop) {
         discovered[v] = true;
         DFSResult *cur = nullptr;
         if (this->computePropertyValues) {
@@ -141,6 +159,7 @@ private:
 
         auto vm = [&](const Vertex *v, const Vertex *u, Arc *arc) {
             PRINT_DEBUG("Considering child " << u << " of " << v);
+            this->profile.add(AlgorithmProfile::ArcsScanned);
 
             bool consider = this->onArcDiscovered(arc);
             stop |= this->arcStopCondition(arc);
@@ -45,7 +45,7 @@ struct AccessibilityAlgorithm::CheshireCat {
         isAccessible.setDefaultValue(allUnknown);
     }
 
-    bool checkAccessibility(DiGraph *graph, Vertex *source, Vertex *target);
+    bool checkAccessibility(DiGraph *graph, Vertex *source, Vertex *target, AlgorithmProfile &profile);
 };
 
 AccessibilityAlgorithm::AccessibilityAlgorithm(bool computeValues)
@@ -65,7 +65,7 @@ bool AccessibilityAlgorithm::canAccess(Vertex *source, Vertex *target)
     if (!boost::logic::indeterminate(accessible)) {
         return accessible ? true : false;
     }
-    return grin->checkAccessibility(diGraph, source, target);
+    return grin->checkAccessibility(diGraph, source, target, profile);
 }
 
 void AccessibilityAlgorithm::run()
@@ -75,16 +75,25 @@ void AccessibilityAlgorithm::run()
 
 void AccessibilityAlgorithm::onDiGraphSet()
 {
+    // counters accumulate over all queries on the same graph
+    profile.reset();
+    AlgorithmProfile::Phase phase(profile, "initialize");
+    auto resizesBefore = AlgorithmProfile::numResizes(&grin->isAccessible);
     grin->isAccessible.resetAll();
     diGraph->mapVertices([&](Vertex *v) {
+        profile.add(AlgorithmProfile::VerticesVisited);
         grin->isAccessible[v][v] = true;
     });
     diGraph->mapArcs([&](Arc *a) {
+        profile.add(AlgorithmProfile::ArcsScanned);
         grin->isAccessible[a->getTail()][a->getHead()] = true;
     });
+    profile.add(AlgorithmProfile::PropertyMapResizes,
+                AlgorithmProfile::numResizes(&grin->isAccessible) - resizesBefore);
 }
 
-bool AccessibilityAlgorithm::CheshireCat::checkAccessibility(DiGraph *graph, Vertex *source, Vertex *target)
+bool AccessibilityAlgorithm::CheshireCat::checkAccessibility(DiGraph *graph, Vertex *source, Vertex *target,
+                                                             AlgorithmProfile &profile)
 {
     BreadthFirstSearch<> bfs(false);
     bfs.setGraph(graph);
@@ -108,6 +117,7 @@ bool AccessibilityAlgorithm::CheshireCat::checkAccessibility(DiGraph *graph, Ver
     }
     bfs.run();
     bfs.deliver();
+    profile.merge(bfs.getProfile(), "bfs");
 
     return pathFound;
 }
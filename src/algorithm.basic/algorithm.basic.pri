@@ -26,6 +26,7 @@ HEADERS += \
     $$PWD/finddipathalgorithm.h \
     $$PWD/basic_algorithms.h \
     $$PWD/tarjansccalgorithm.h \
+    $$PWD/parallelsccalgorithm.h \
     $$PWD/topsortalgorithm.h \
     $$PWD/biconnectedcomponentsalgorithm.h \
     $$PWD/accessibilityalgorithm.h \
@@ -35,6 +36,7 @@ HEADERS += \
 SOURCES += \
     $$PWD/finddipathalgorithm.cpp \
     $$PWD/tarjansccalgorithm.cpp \
+    $$PWD/parallelsccalgorithm.cpp \
     $$PWD/topsortalgorithm.cpp \
     $$PWD/basic_algorithms.cpp \
     $$PWD/biconnectedcomponentsalgorithm.cpp \
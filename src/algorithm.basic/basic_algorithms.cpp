@@ -23,11 +23,13 @@
 #include "basic_algorithms.h"
 
 #include "graph/digraph.h"
+#include "graph.incidencelist/incidencelistgraph.h"
 #include "property/propertymap.h"
 
 #include "algorithm.basic.traversal/breadthfirstsearch.h"
 #include "algorithm.basic.traversal/depthfirstsearch.h"
 #include "tarjansccalgorithm.h"
+#include "parallelsccalgorithm.h"
 #include "topsortalgorithm.h"
 #include "biconnectedcomponentsalgorithm.h"
 #include "eccentricityalgorithm.h"
@@ -35,6 +37,21 @@
 
 namespace Algora {
 
+namespace {
+DiGraph::size_type computeStrongComponents(DiGraph *diGraph, ModifiableProperty<DiGraph::size_type> &sccOf,
+                                           bool parallel)
+{
+    if (parallel && dynamic_cast<IncidenceListGraph*>(diGraph) != nullptr) {
+        ParallelSCCAlgorithm parallelScc;
+        parallelScc.useModifiableProperty(&sccOf);
+        return runAlgorithm(parallelScc, diGraph);
+    }
+    TarjanSCCAlgorithm tarjan;
+    tarjan.useModifiableProperty(&sccOf);
+    return runAlgorithm(tarjan, diGraph);
+}
+}
+
 bool hasDiPath(DiGraph *diGraph, Vertex *from, Vertex *to) {
     FindDiPathAlgorithm<> findDiPath(false, false, true);
     return runDiPathAlgorithm(diGraph, from, to, findDiPath);
@@ -51,12 +68,10 @@ bool isStronglyConnected(DiGraph *diGraph)
     return countStrongComponents(diGraph) == 1;
 }
 
-DiGraph::size_type countStrongComponents(DiGraph *diGraph)
+DiGraph::size_type countStrongComponents(DiGraph *diGraph, bool parallel)
 {
-    TarjanSCCAlgorithm tarjan;
     PropertyMap<DiGraph::size_type> sccs(0);
-    tarjan.useModifiableProperty(&sccs);
-    return runAlgorithm(tarjan, diGraph);
+    return computeStrongComponents(diGraph, sccs, parallel);
 }
 
 bool isBiconnected(DiGraph *diGraph)
@@ -103,12 +118,10 @@ int computeDiameter(DiGraph *diGraph)
     return runAlgorithm(rd, diGraph);
 }
 
-void computeCondensation(DiGraph *diGraph, DiGraph *condensedGraph)
+void computeCondensation(DiGraph *diGraph, DiGraph *condensedGraph, bool parallel)
 {
-    TarjanSCCAlgorithm tarjan;
     PropertyMap<DiGraph::size_type> sccOf(0);
-    tarjan.useModifiableProperty(&sccOf);
-    auto sccs = runAlgorithm(tarjan, diGraph);
+    auto sccs = computeStrongComponents(diGraph, sccOf, parallel);
     condensedGraph->clear();
     std::vector<Vertex*> sccVertices;
     for (auto i = 0UL; i < sccs; i++) {
@@ -38,7 +38,9 @@ bool isAcyclic(DiGraph *diGraph);
 
 bool isStronglyConnected(DiGraph *diGraph);
 
-DiGraph::size_type countStrongComponents(DiGraph *diGraph);
+// uses TarjanSCCAlgorithm, or ParallelSCCAlgorithm if parallel is set and
+// diGraph is an IncidenceListGraph (same for computeCondensation())
+DiGraph::size_type countStrongComponents(DiGraph *diGraph, bool parallel = false);
 
 bool isBiconnected(DiGraph *diGraph);
 
@@ -50,7 +52,9 @@ int computeRadius(DiGraph *diGraph);
 
 int computeDiameter(DiGraph *diGraph);
 
-void computeCondensation(DiGraph *diGraph, DiGraph *condensedGraph);
+// with parallel set, the vertices of condensedGraph are not in reverse
+// topological order
+void computeCondensation(DiGraph *diGraph, DiGraph *condensedGraph, bool parallel = false);
 
 }
 
@@ -54,6 +54,7 @@ BiconnectedComponentsAlgorithm::~BiconnectedComponentsAlgorithm()
 
 void BiconnectedComponentsAlgorithm::run()
 {
+    profile.reset();
     DFSResult none;
     PropertyMap<DFSResult> dfsResult(none);
     DepthFirstSearch<PropertyMap, false, true> dfs;
@@ -68,11 +69,16 @@ void BiconnectedComponentsAlgorithm::run()
             PRINT_DEBUG("Running DFS starting from " << v);
             dfs.setStartVertex(v);
             verticesReached += runAlgorithm(dfs, diGraph);
+            profile.merge(dfs.getProfile(), "dfs");
         }
         dfsNum = dfsResult(v).dfsNumber;
         dfsOrderRev[verticesReached - 1 - dfsNum] = v;
     });
+    AlgorithmProfile::Phase phase(profile, "components");
+    auto resizesBefore = AlgorithmProfile::numResizes(property);
     numBics = findBiconnectedComponents(dfsOrderRev, dfsResult, *property);
+    profile.add(AlgorithmProfile::PropertyMapResizes,
+                AlgorithmProfile::numResizes(property) - resizesBefore);
 }
 
 int BiconnectedComponentsAlgorithm::deliver()
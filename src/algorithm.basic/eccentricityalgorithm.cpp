@@ -49,6 +49,8 @@ void EccentricityAlgorithm::run()
     bfs.setStartVertex(vertex);
     bfs.orderAsValues(false);
     eccentricity = runAlgorithm(bfs, diGraph) == diGraph->getSize() ? bfs.getMaxLevel() :  INFINITE;
+    profile.reset();
+    profile.merge(bfs.getProfile(), "bfs");
 }
 
 void EccentricityAlgorithm::onDiGraphSet() {
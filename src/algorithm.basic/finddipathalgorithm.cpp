@@ -62,6 +62,7 @@ bool FindDiPathAlgorithm<property_map_type>::prepare()
 template<template <typename T> typename property_map_type>
 void FindDiPathAlgorithm<property_map_type>::run()
 {
+    profile.reset();
     if (from == to) {
         pathFound = true;
         return;
@@ -166,6 +167,8 @@ void FindDiPathAlgorithm<property_map_type>::runTwoWaySearch()
     }
     pathFound = reachable;
     pr_num_vertices_seen += forwardBfs.numVerticesReached() + backwardBfs.numVerticesReached();
+    profile.merge(forwardBfs.getProfile(), "forward_bfs");
+    profile.merge(backwardBfs.getProfile(), "backward_bfs");
 }
 
 template<template <typename T> typename property_map_type>
@@ -265,6 +268,11 @@ void FindDiPathAlgorithm<property_map_type>::runTwoWayPathSearch()
         backwardBfs.resume();
     }
 
+    profile.merge(forwardBfs.getProfile(), "forward_bfs");
+    profile.merge(backwardBfs.getProfile(), "backward_bfs");
+    profile.add(AlgorithmProfile::PropertyMapResizes, AlgorithmProfile::numResizes(&treeArc));
+
+    AlgorithmProfile::Phase phase(profile, "path");
     arcPath.clear();
     if (fbLink) {
         auto v = fbLink->getTail();
@@ -318,6 +326,7 @@ void FindDiPathAlgorithm<property_map_type>::runOneWaySearch()
     });
     runAlgorithm(bfs, diGraph);
     pr_num_vertices_seen += bfs.numVerticesReached();
+    profile.merge(bfs.getProfile(), "bfs");
 }
 
 template<template <typename T> typename property_map_type>
@@ -341,7 +350,10 @@ void FindDiPathAlgorithm<property_map_type>::runOneWayPathSearch()
         return pathFound;
     });
     runAlgorithm(bfs, diGraph);
+    profile.merge(bfs.getProfile(), "bfs");
+    profile.add(AlgorithmProfile::PropertyMapResizes, AlgorithmProfile::numResizes(&pred));
 
+    AlgorithmProfile::Phase phase(profile, "path");
     if (pathFound && (constructVertexPath || constructArcPath)) {
         arcPath.clear();
         Vertex *p = to;
@@ -0,0 +1,356 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "parallelsccalgorithm.h"
+
+#include "graph.incidencelist/incidencelistgraph.h"
+#include "graph.incidencelist/incidencelistvertex.h"
+#include "graph/arc.h"
+#include "property/modifiableproperty.h"
+#include "parallel/workstealingpool.h"
+#include "parallel/parallelmap.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Algora {
+
+namespace {
+typedef DiGraph::size_type size_type;
+constexpr size_type NONE = std::numeric_limits<size_type>::max();
+// frontier vertices per chunk in level-synchronous searches
+constexpr size_type FRONTIER_CHUNK = 256U;
+// roots per chunk when decomposing color classes
+constexpr size_type ROOT_CHUNK = 64U;
+}
+
+struct ParallelSCCAlgorithm::CheshireCat {
+    WorkStealingPool &pool;
+    VertexRanges ranges;
+    std::vector<IncidenceListVertex*> vertices;
+    // per vertex index: component label (index of its pivot or root),
+    // NONE while undecided; scratch values of the current phase
+    std::unique_ptr<std::atomic<size_type>[]> component;
+    std::unique_ptr<std::atomic<size_type>[]> first;
+    std::unique_ptr<std::atomic<size_type>[]> second;
+    // vertices found by each worker
+    std::vector<std::vector<size_type>> found;
+
+    CheshireCat(const IncidenceListGraph &graph, WorkStealingPool &pool)
+        : pool(pool), ranges(partitionVerticesByDegree(graph, pool)),
+          component(new std::atomic<size_type>[graph.getSize()]),
+          first(new std::atomic<size_type>[graph.getSize()]),
+          second(new std::atomic<size_type>[graph.getSize()]),
+          found(pool.getNumThreads()) {
+        vertices.reserve(graph.getSize());
+        for (auto i = 0ULL; i < graph.getSize(); i++) {
+            vertices.push_back(graph.vertexAt(i));
+        }
+        forAll([this](size_type i, unsigned int) {
+            component[i].store(NONE, std::memory_order_relaxed);
+        });
+    }
+
+    static size_type indexOf(const Vertex *v) {
+        return static_cast<const IncidenceListVertex*>(v)->getIndex();
+    }
+
+    bool isOpen(size_type i) const {
+        return component[i].load(std::memory_order_relaxed) == NONE;
+    }
+
+    bool claim(size_type i) {
+        auto expected = NONE;
+        return component[i].compare_exchange_strong(expected, i);
+    }
+
+    template<typename F>
+    void mapSuccessors(size_type i, const F &f) const {
+        vertices[i]->mapOutgoingArcs([&f](Arc *a) { f(indexOf(a->getHead())); });
+    }
+
+    template<typename F>
+    void mapPredecessors(size_type i, const F &f) const {
+        vertices[i]->mapIncomingArcs([&f](Arc *a) { f(indexOf(a->getTail())); });
+    }
+
+    // calls f(index, worker) for all vertices, in parallel
+    template<typename F>
+    void forAll(const F &f) {
+        pool.run(ranges.size() - 1U, [&](WorkStealingPool::size_type r, unsigned int worker) {
+            for (auto i = ranges[r]; i < ranges[r + 1U]; i++) {
+                f(i, worker);
+            }
+        });
+    }
+
+    void takeFound(std::vector<size_type> &out) {
+        for (auto &f : found) {
+            out.insert(out.end(), f.begin(), f.end());
+            f.clear();
+        }
+    }
+
+    // level-synchronous search: visit(v, level, next) is called in parallel
+    // for all vertices v of a level and appends the next level's vertices
+    template<typename Visit>
+    void search(std::vector<size_type> &frontier, const Visit &visit) {
+        auto level = 0ULL;
+        while (!frontier.empty()) {
+            auto numChunks = (frontier.size() + FRONTIER_CHUNK - 1U) / FRONTIER_CHUNK;
+            pool.run(numChunks, [&](WorkStealingPool::size_type c, unsigned int worker) {
+                auto end = std::min<size_type>(frontier.size(), (c + 1U) * FRONTIER_CHUNK);
+                for (auto k = c * FRONTIER_CHUNK; k < end; k++) {
+                    visit(frontier[k], level, found[worker]);
+                }
+            });
+            frontier.clear();
+            takeFound(frontier);
+            level++;
+        }
+    }
+
+    void trim();
+    void forwardBackward();
+    void color();
+};
+
+ParallelSCCAlgorithm::ParallelSCCAlgorithm(WorkStealingPool *pool)
+    : PropertyComputingAlgorithm<DiGraph::size_type, DiGraph::size_type>(true),
+      pool(pool), numSccs(0U)
+{
+
+}
+
+ParallelSCCAlgorithm::~ParallelSCCAlgorithm()
+{
+
+}
+
+bool ParallelSCCAlgorithm::prepare()
+{
+    return PropertyComputingAlgorithm<DiGraph::size_type, DiGraph::size_type>::prepare()
+            && dynamic_cast<IncidenceListGraph*>(diGraph) != nullptr;
+}
+
+void ParallelSCCAlgorithm::run()
+{
+    this->profile.reset();
+    auto *graph = static_cast<IncidenceListGraph*>(diGraph);
+    CheshireCat state(*graph, pool ? *pool : WorkStealingPool::getDefault());
+    {
+        AlgorithmProfile::Phase phase(this->profile, "trim");
+        state.trim();
+    }
+    {
+        AlgorithmProfile::Phase phase(this->profile, "forward-backward");
+        state.forwardBackward();
+        state.trim();
+    }
+    {
+        AlgorithmProfile::Phase phase(this->profile, "coloring");
+        state.color();
+    }
+
+    AlgorithmProfile::Phase phase(this->profile, "renumber");
+    std::vector<size_type> number(state.vertices.size(), NONE);
+    numSccs = 0U;
+    for (auto i = 0ULL; i < state.vertices.size(); i++) {
+        auto &n = number[state.component[i].load(std::memory_order_relaxed)];
+        if (n == NONE) {
+            n = numSccs++;
+        }
+        if (computePropertyValues) {
+            property->setValue(state.vertices[i], n);
+        }
+    }
+}
+
+// Repeatedly removes open vertices without open predecessors or successors,
+// each of which is a component of its own. Self-loops are ignored.
+// first and second hold the numbers of open predecessors and successors.
+void ParallelSCCAlgorithm::CheshireCat::trim()
+{
+    auto &inDegree = first;
+    auto &outDegree = second;
+    forAll([&](size_type i, unsigned int worker) {
+        if (!isOpen(i)) {
+            return;
+        }
+        size_type in = 0U, out = 0U;
+        mapPredecessors(i, [&](size_type t) { in += t != i && isOpen(t); });
+        mapSuccessors(i, [&](size_type h) { out += h != i && isOpen(h); });
+        inDegree[i].store(in, std::memory_order_relaxed);
+        outDegree[i].store(out, std::memory_order_relaxed);
+        if (in == 0U || out == 0U) {
+            found[worker].push_back(i);
+        }
+    });
+    std::vector<size_type> frontier;
+    takeFound(frontier);
+    for (auto i : frontier) {
+        component[i].store(i, std::memory_order_relaxed);
+    }
+    search(frontier, [&](size_type v, size_type, std::vector<size_type> &next) {
+        mapSuccessors(v, [&](size_type h) {
+            if (h != v && isOpen(h) && inDegree[h].fetch_sub(1U) == 1U && claim(h)) {
+                next.push_back(h);
+            }
+        });
+        mapPredecessors(v, [&](size_type t) {
+            if (t != v && isOpen(t) && outDegree[t].fetch_sub(1U) == 1U && claim(t)) {
+                next.push_back(t);
+            }
+        });
+    });
+}
+
+// Finds the component of the open vertex with the most arcs to open vertices,
+// typically the giant one, as the intersection of its forward and backward
+// reachable sets. Relies on the degrees left by trim().
+void ParallelSCCAlgorithm::CheshireCat::forwardBackward()
+{
+    typedef std::pair<size_type, size_type> Candidate;
+    auto pivot = parallelReduceRanges(ranges, Candidate(0U, NONE),
+                                      [this](size_type begin, size_type end) {
+        Candidate best(0U, NONE);
+        for (auto i = begin; i < end; i++) {
+            if (isOpen(i)) {
+                auto weight = (first[i].load(std::memory_order_relaxed) + 1U)
+                        * (second[i].load(std::memory_order_relaxed) + 1U);
+                if (best.second == NONE || weight > best.first) {
+                    best = Candidate(weight, i);
+                }
+            }
+        }
+        return best;
+    }, [](const Candidate &a, const Candidate &b) {
+        return b.second != NONE && (a.second == NONE || b.first > a.first) ? b : a;
+    }, pool).second;
+    if (pivot == NONE) {
+        return;
+    }
+
+    // first: 1 if reached forward, 2 if also reached backward
+    const size_type FORWARD = 1U, BACKWARD = 2U;
+    auto &reached = first;
+    forAll([&](size_type i, unsigned int) {
+        reached[i].store(0U, std::memory_order_relaxed);
+    });
+
+    reached[pivot].store(FORWARD);
+    std::vector<size_type> frontier { pivot };
+    search(frontier, [&](size_type v, size_type, std::vector<size_type> &next) {
+        mapSuccessors(v, [&](size_type h) {
+            if (isOpen(h) && reached[h].fetch_or(FORWARD) == 0U) {
+                next.push_back(h);
+            }
+        });
+    });
+
+    reached[pivot].fetch_or(BACKWARD);
+    component[pivot].store(pivot);
+    frontier.push_back(pivot);
+    search(frontier, [&](size_type v, size_type, std::vector<size_type> &next) {
+        mapPredecessors(v, [&](size_type t) {
+            if (reached[t].load(std::memory_order_relaxed) == FORWARD
+                    && reached[t].fetch_or(BACKWARD) == FORWARD) {
+                component[t].store(pivot, std::memory_order_relaxed);
+                next.push_back(t);
+            }
+        });
+    });
+}
+
+// Each open vertex gets the largest index of the open vertices that reach it
+// as color. A vertex whose color is its own index is a root, and its
+// component consists of the vertices of its color that reach it. Roots are
+// processed in parallel; this is repeated until no vertex is left open.
+// first holds the colors, second the level at which a vertex has last been
+// queued.
+void ParallelSCCAlgorithm::CheshireCat::color()
+{
+    auto &colorOf = first;
+    auto &queued = second;
+    while (true) {
+        forAll([&](size_type i, unsigned int worker) {
+            if (isOpen(i)) {
+                colorOf[i].store(i, std::memory_order_relaxed);
+                queued[i].store(NONE, std::memory_order_relaxed);
+                found[worker].push_back(i);
+            }
+        });
+        std::vector<size_type> frontier;
+        takeFound(frontier);
+        if (frontier.empty()) {
+            return;
+        }
+
+        search(frontier, [&](size_type v, size_type level, std::vector<size_type> &next) {
+            auto c = colorOf[v].load();
+            mapSuccessors(v, [&](size_type h) {
+                if (!isOpen(h)) {
+                    return;
+                }
+                auto current = colorOf[h].load();
+                while (current < c && !colorOf[h].compare_exchange_weak(current, c)) { }
+                if (current < c && queued[h].exchange(level) != level) {
+                    next.push_back(h);
+                }
+            });
+        });
+
+        forAll([&](size_type i, unsigned int worker) {
+            if (isOpen(i) && colorOf[i].load(std::memory_order_relaxed) == i) {
+                found[worker].push_back(i);
+            }
+        });
+        std::vector<size_type> roots;
+        takeFound(roots);
+        pool.run((roots.size() + ROOT_CHUNK - 1U) / ROOT_CHUNK,
+                 [&](WorkStealingPool::size_type c, unsigned int) {
+            std::vector<size_type> stack;
+            auto end = std::min<size_type>(roots.size(), (c + 1U) * ROOT_CHUNK);
+            for (auto k = c * ROOT_CHUNK; k < end; k++) {
+                auto r = roots[k];
+                component[r].store(r, std::memory_order_relaxed);
+                stack.push_back(r);
+                while (!stack.empty()) {
+                    auto v = stack.back();
+                    stack.pop_back();
+                    mapPredecessors(v, [&](size_type t) {
+                        if (colorOf[t].load(std::memory_order_relaxed) == r && isOpen(t)) {
+                            component[t].store(r, std::memory_order_relaxed);
+                            stack.push_back(t);
+                        }
+                    });
+                }
+            }
+        });
+    }
+}
+
+}
@@ -0,0 +1,72 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef PARALLELSCCALGORITHM_H
+#define PARALLELSCCALGORITHM_H
+
+#include "algorithm/propertycomputingalgorithm.h"
+#include "graph/digraph.h"
+
+namespace Algora {
+
+class WorkStealingPool;
+
+// Computes the strongly connected components of an IncidenceListGraph using
+// several threads: vertices without incoming or outgoing arcs are trimmed,
+// the component of a high-degree pivot is found by forward-backward search,
+// and the rest is decomposed by coloring (propagating the largest vertex index
+// forward, then searching backward from each color's root).
+// Like TarjanSCCAlgorithm, it assigns each vertex the number of its component
+// and delivers the number of components; here, components are numbered in the
+// order of their first vertex in the graph's iteration order, and not
+// topologically. The graph is traversed read-only (see IncidenceListGraph).
+class ParallelSCCAlgorithm : public PropertyComputingAlgorithm<DiGraph::size_type, DiGraph::size_type>
+{
+public:
+    // pool = nullptr: WorkStealingPool::getDefault()
+    explicit ParallelSCCAlgorithm(WorkStealingPool *pool = nullptr);
+    virtual ~ParallelSCCAlgorithm() override;
+
+    void setPool(WorkStealingPool *pool) { this->pool = pool; }
+
+    // DiGraphAlgorithm interface
+public:
+    // the graph must be an IncidenceListGraph
+    virtual bool prepare() override;
+    virtual void run() override;
+    virtual std::string getName() const noexcept override { return "Parallel SCC"; }
+    virtual std::string getShortName() const noexcept override { return "pscc"; }
+
+    // ValueComputingAlgorithm interface
+public:
+    virtual DiGraph::size_type deliver() override { return numSccs; }
+
+private:
+    WorkStealingPool *pool;
+    DiGraph::size_type numSccs;
+
+    struct CheshireCat;
+};
+
+}
+
+#endif // PARALLELSCCALGORITHM_H
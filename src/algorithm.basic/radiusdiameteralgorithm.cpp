@@ -40,6 +40,7 @@ RadiusDiameterAlgorithm::RadiusDiameterAlgorithm(bool radiusOnly, bool diameterO
 
 void RadiusDiameterAlgorithm::run()
 {
+    profile.reset();
     radius = INT_MAX;
     diameter = -1;
     EccentricityAlgorithm ecc;
@@ -47,6 +48,7 @@ void RadiusDiameterAlgorithm::run()
     diGraph->mapVerticesUntil([&](Vertex *v) {
         ecc.setVertex(v);
         int e = runAlgorithm(ecc, diGraph);
+        profile.merge(ecc.getProfile(), "eccentricity");
         if (e > diameter) {
             diameter = e;
             if (diamOnly && diameter == INFINITE) {
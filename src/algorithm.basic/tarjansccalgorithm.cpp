@@ -50,15 +50,17 @@ const static DiGraph::size_type UNSET = std::numeric_limits<DiGraph::size_type>:
 
 template <template<typename T> class ModifiablePropertyType = PropertyMap>
 DiGraph::size_type tarjanRecursive(DiGraph *diGraph,
-                                   ModifiableProperty<DiGraph::size_type> &sccNumber);
+                                   ModifiableProperty<DiGraph::size_type> &sccNumber,
+                                   AlgorithmProfile &profile);
 
-void strongconnect(DiGraph *graph, Vertex *v,
+inline void strongconnect(DiGraph *graph, Vertex *v,
                    DiGraph::size_type &nextIndex, DiGraph::size_type &nextScc,
                    std::vector<Vertex*> &stack,
                    ModifiableProperty<DiGraph::size_type> &vertexIndex,
                    ModifiableProperty<DiGraph::size_type> &lowLink,
                    ModifiableProperty<bool> &onStack,
-                   ModifiableProperty<DiGraph::size_type> &sccNumber);
+                   ModifiableProperty<DiGraph::size_type> &sccNumber,
+                   AlgorithmProfile &profile);
 
 template <template<typename T> class ModifiablePropertyType>
 TarjanSCCAlgorithm<ModifiablePropertyType>::TarjanSCCAlgorithm()
@@ -76,8 +78,16 @@ TarjanSCCAlgorithm<ModifiablePropertyType>::~TarjanSCCAlgorithm()
 template <template<typename T> class ModifiablePropertyType>
 void TarjanSCCAlgorithm<ModifiablePropertyType>::run()
 {
-    numSccs = tarjanRecursive<ModifiablePropertyType>(diGraph, *this->property);
+    this->profile.reset();
+    auto resizesBefore = AlgorithmProfile::numResizes(this->property);
+    {
+        AlgorithmProfile::Phase phase(this->profile, "search");
+        numSccs = tarjanRecursive<ModifiablePropertyType>(diGraph, *this->property, this->profile);
+    }
+    this->profile.add(AlgorithmProfile::PropertyMapResizes,
+                      AlgorithmProfile::numResizes(this->property) - resizesBefore);
 
+    AlgorithmProfile::Phase phase(this->profile, "renumber");
     if (numSccs > 1) {
         diGraph->mapVertices([&](Vertex *v) {
             property->setValue(v,
@@ -94,7 +104,8 @@ DiGraph::size_type TarjanSCCAlgorithm<ModifiablePropertyType>::deliver()
 
 template <template<typename T> class ModifiablePropertyType>
 GraphArtifact::size_type tarjanRecursive(DiGraph *diGraph,
-                                         ModifiableProperty<DiGraph::size_type> &sccNumber) {
+                                         ModifiableProperty<DiGraph::size_type> &sccNumber,
+                                         AlgorithmProfile &profile) {
     DiGraph::size_type nextIndex = 0;
     DiGraph::size_type nextScc = 0;
     std::vector<Vertex*> stack;
@@ -104,19 +115,23 @@ GraphArtifact::size_type tarjanRecursive(DiGraph *diGraph,
 
     diGraph->mapVertices([&](Vertex *v) {
         if (vertexIndex(v) == UNSET) {
-            strongconnect(diGraph, v, nextIndex, nextScc, stack, vertexIndex, lowLink, onStack, sccNumber);
+            strongconnect(diGraph, v, nextIndex, nextScc, stack, vertexIndex, lowLink, onStack, sccNumber,
+                          profile);
         }
     });
+    profile.add(AlgorithmProfile::PropertyMapResizes,
+                AlgorithmProfile::numResizes(&vertexIndex, &lowLink, &onStack));
     return nextScc;
 }
 
-void strongconnect(DiGraph *graph, Vertex *v,
+inline void strongconnect(DiGraph *graph, Vertex *v,
                    GraphArtifact::size_type &nextIndex, GraphArtifact::size_type &nextScc,
                    std::vector<Vertex *> &stack,
                    ModifiableProperty<DiGraph::size_type> &vertexIndex,
                    ModifiableProperty<DiGraph::size_type> &lowLink,
                    ModifiableProperty<bool> &onStack,
-                   ModifiableProperty<DiGraph::size_type> &sccNumber) {
+                   ModifiableProperty<DiGraph::size_type> &sccNumber,
+                   AlgorithmProfile &profile) {
 
     PRINT_DEBUG( "strongconnect on " << v )
     auto vLowLink = nextIndex;
@@ -127,13 +142,17 @@ void strongconnect(DiGraph *graph, Vertex *v,
     nextIndex++;
     stack.push_back(v);
     onStack.setValue(v, true);
+    profile.add(AlgorithmProfile::VerticesVisited);
+    profile.peak(AlgorithmProfile::QueuePeakSize, stack.size());
 
     graph->mapOutgoingArcs(v, [&](Arc *a) {
+        profile.add(AlgorithmProfile::ArcsScanned);
         Vertex *head = a->getHead();
         PRINT_DEBUG( "considering out-neighbor " << head )
         if (vertexIndex(head) == UNSET) {
             PRINT_DEBUG( "neighbor has no index yet." )
-            strongconnect(graph, head, nextIndex, nextScc, stack, vertexIndex, lowLink, onStack, sccNumber);
+            strongconnect(graph, head, nextIndex, nextScc, stack, vertexIndex, lowLink, onStack, sccNumber,
+                          profile);
             auto hLowLink = lowLink(head);
             PRINT_DEBUG( "neighbor has lowlink " << hLowLink )
             if (hLowLink < vLowLink) {
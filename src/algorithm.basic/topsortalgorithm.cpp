@@ -76,23 +76,31 @@ bool TopSortAlgorithm::isSortedTopologically(const std::vector<Vertex *> &seq) c
 void TopSortAlgorithm::run()
 {
     sequence.clear();
+    profile.reset();
+    auto resizesBefore = AlgorithmProfile::numResizes(property);
 
     PropertyMap<int> inDegree(-1);
 
     std::vector<Vertex*> sources;
 
-    diGraph->mapVertices([&](Vertex *v) {
-        int indegree = diGraph->getInDegree(v, true);
-        if (indegree == 0) {
-            sources.push_back(v);
-        } else {
-            inDegree[v] = indegree;
-        }
-    });
+    {
+        AlgorithmProfile::Phase phase(profile, "initialize");
+        diGraph->mapVertices([&](Vertex *v) {
+            int indegree = diGraph->getInDegree(v, true);
+            if (indegree == 0) {
+                sources.push_back(v);
+            } else {
+                inDegree[v] = indegree;
+            }
+        });
+    }
     PRINT_DEBUG( "Queue contains " << sources.size() << " sources." );
 
+    AlgorithmProfile::Phase phase(profile, "sort");
     int ts = 0;
     while (!sources.empty()) {
+        profile.peak(AlgorithmProfile::QueuePeakSize, sources.size());
+        profile.add(AlgorithmProfile::VerticesVisited);
         Vertex *v = sources.back();
         sources.pop_back();
 
@@ -104,6 +112,7 @@ void TopSortAlgorithm::run()
         sequence.push_back(v);
 
         diGraph->mapOutgoingArcs(v, [&](Arc *a) {
+            profile.add(AlgorithmProfile::ArcsScanned);
             Vertex *head = a->getHead();
             if (inDegree(head) == 1) {
                 sources.push_back(head);
@@ -112,6 +121,8 @@ void TopSortAlgorithm::run()
             }
         });
     }
+    profile.set(AlgorithmProfile::PropertyMapResizes,
+                AlgorithmProfile::numResizes(&inDegree, property) - resizesBefore);
 }
 
 }
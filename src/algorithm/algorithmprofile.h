@@ -0,0 +1,184 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef ALGORITHMPROFILE_H
+#define ALGORITHMPROFILE_H
+
+#include <array>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Algora {
+
+// Counters and per-phase wall times of one algorithm run.
+// Profiling is enabled by defining ALGORA_PROFILING (qmake: CONFIG+=profiling).
+// Otherwise, all updates are compiled out and the profile stays empty.
+// The layout is the same either way.
+class AlgorithmProfile
+{
+public:
+    typedef unsigned long long counter_type;
+
+    enum Counter {
+        VerticesVisited,
+        ArcsScanned,
+        QueuePeakSize,      // largest queue, stack or recursion depth
+        PropertyMapResizes,
+        NUM_COUNTERS
+    };
+
+    static const char *getCounterName(Counter c) {
+        static const char *names[NUM_COUNTERS] = {
+            "vertices_visited", "arcs_scanned", "queue_peak_size", "property_map_resizes"
+        };
+        return names[c];
+    }
+
+    // total number of resizes of the given properties, null pointers are skipped
+    template<typename... Properties>
+    static counter_type numResizes(const Properties *...properties) {
+#ifdef ALGORA_PROFILING
+        return (0ULL + ... + (properties ? properties->getNumResizes() : 0ULL));
+#else
+        ((void) properties, ...);
+        return 0U;
+#endif
+    }
+
+#ifdef ALGORA_PROFILING
+    static constexpr bool enabled = true;
+#else
+    static constexpr bool enabled = false;
+#endif
+
+    AlgorithmProfile() { reset(); }
+
+    void reset() {
+        counters.fill(0U);
+        phases.clear();
+    }
+
+    void add(Counter c, counter_type amount = 1U) {
+        if constexpr (enabled) {
+            counters[c] += amount;
+        }
+    }
+
+    void peak(Counter c, counter_type value) {
+        if constexpr (enabled) {
+            if (value > counters[c]) {
+                counters[c] = value;
+            }
+        }
+    }
+
+    void set(Counter c, counter_type value) {
+        if constexpr (enabled) {
+            counters[c] = value;
+        }
+    }
+
+    counter_type get(Counter c) const {
+        return counters[c];
+    }
+
+    void addPhase(const std::string &name, double seconds) {
+        if constexpr (enabled) {
+            for (auto &p : phases) {
+                if (p.first == name) {
+                    p.second += seconds;
+                    return;
+                }
+            }
+            phases.emplace_back(name, seconds);
+        }
+    }
+
+    const std::vector<std::pair<std::string, double>> &getPhases() const {
+        return phases;
+    }
+
+    // adds the counters and phase times of a sub-algorithm's run,
+    // phase names get the given prefix
+    void merge(const AlgorithmProfile &other, const char *prefix) {
+        if constexpr (enabled) {
+            for (auto c = 0U; c < NUM_COUNTERS; c++) {
+                if (c == QueuePeakSize) {
+                    peak(QueuePeakSize, other.counters[c]);
+                } else {
+                    counters[c] += other.counters[c];
+                }
+            }
+            for (const auto &p : other.phases) {
+                addPhase(std::string(prefix) + "_" + p.first, p.second);
+            }
+        }
+    }
+
+    // one "key=value" pair per line, phase times in seconds;
+    // empty if profiling is disabled
+    std::string toString() const {
+        if constexpr (!enabled) {
+            return std::string();
+        }
+        std::ostringstream s;
+        for (auto c = 0U; c < NUM_COUNTERS; c++) {
+            s << getCounterName(static_cast<Counter>(c)) << "=" << counters[c] << "\n";
+        }
+        for (const auto &p : phases) {
+            s << "phase_" << p.first << "_seconds=" << p.second << "\n";
+        }
+        return s.str();
+    }
+
+    // measures the wall time of the enclosing scope
+    class Phase {
+    public:
+        Phase(AlgorithmProfile &profile, const char *name)
+            : profile(profile), name(name) {
+            if constexpr (enabled) {
+                start = std::chrono::steady_clock::now();
+            }
+        }
+        ~Phase() {
+            if constexpr (enabled) {
+                profile.addPhase(name, std::chrono::duration<double>(
+                                     std::chrono::steady_clock::now() - start).count());
+            }
+        }
+    private:
+        AlgorithmProfile &profile;
+        const char *name;
+        std::chrono::steady_clock::time_point start;
+    };
+
+private:
+    std::array<counter_type, NUM_COUNTERS> counters;
+    std::vector<std::pair<std::string, double>> phases;
+};
+
+}
+
+#endif // ALGORITHMPROFILE_H
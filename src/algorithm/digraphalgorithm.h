@@ -23,6 +23,8 @@
 #ifndef DIGRAPHALGORITHM_H
 #define DIGRAPHALGORITHM_H
 
+#include "algorithmprofile.h"
+
 #include <string>
 
 namespace Algora {
@@ -50,10 +52,13 @@ public:
 
     virtual std::string getName() const noexcept = 0;
     virtual std::string getShortName() const noexcept = 0;
-    virtual std::string getProfilingInfo() const { return ""; }
+    virtual std::string getProfilingInfo() const { return profile.toString(); }
+    // counters of the last run, all zero unless ALGORA_PROFILING is defined
+    const AlgorithmProfile &getProfile() const { return profile; }
 
 protected:
     DiGraph *diGraph;
+    AlgorithmProfile profile;
     virtual void onDiGraphSet() { }
     virtual void onDiGraphUnset() { }
 };
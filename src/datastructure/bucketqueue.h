@@ -25,6 +25,8 @@
 
 #include <vector>
 
+#include "memoryusage.h"
+
 namespace Algora {
 
 template<typename T, typename Priority>
@@ -100,6 +102,29 @@ public:
         }
     }
 
+    MemoryUsage memoryUsage() const {
+        MemoryUsage usage = MemoryUsage::of(m_buckets);
+        for (const auto &bucket : m_buckets) {
+            usage += MemoryUsage::of(bucket);
+        }
+        return usage;
+    }
+
+    // drops the empty buckets above the top priority and releases unused capacity
+    void fit() {
+        if (m_size == 0UL) {
+            m_buckets.clear();
+            m_top = 0UL;
+            m_bot = 0UL;
+        } else {
+            m_buckets.resize(m_top + 1);
+        }
+        for (auto &bucket : m_buckets) {
+            bucket.shrink_to_fit();
+        }
+        m_buckets.shrink_to_fit();
+    }
+
 private:
     std::vector<std::vector<value_type>> m_buckets;
     size_type m_size;
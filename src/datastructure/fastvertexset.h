@@ -77,6 +77,15 @@ public:
         return set.size();
     }
 
+    MemoryUsage memoryUsage() const {
+        return MemoryUsage::of(set) + setIndex.memoryUsage();
+    }
+
+    void fit() {
+        set.shrink_to_fit();
+        setIndex.fit();
+    }
+
     const_iterator cbegin() const {
         return set.cbegin();
     }
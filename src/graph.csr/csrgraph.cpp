@@ -0,0 +1,438 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "csrgraph.h"
+
+#include "io/binarygraphformat.h"
+#include "io/mappedfile.h"
+
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+
+namespace Algora {
+
+using namespace BinaryGraphFormat;
+
+namespace {
+
+typedef CSRGraph::index_type index_type;
+
+// remembers its position in the target array, as ids may be arbitrary
+class CSRArc : public Arc
+{
+public:
+    CSRArc(Vertex *tail, Vertex *head, id_type id, GraphArtifact *parent, index_type k)
+        : Arc(tail, head, id, parent), index(k) { }
+
+    index_type getIndex() const { return index; }
+
+private:
+    index_type index;
+};
+
+}
+
+struct CSRGraph::Artifacts {
+    // filled once, never reallocated
+    std::vector<Vertex> vertices;
+    std::vector<CSRArc> arcs;
+};
+
+CSRGraph::CSRGraph(GraphArtifact *parent)
+    : DiGraph(parent), numVertices(0U), numArcs(0U), wideIndices(false),
+      outOffsets(nullptr), outTargets(nullptr), arcIds(nullptr), arcWeights(nullptr),
+      inOffsets(nullptr), inSources(nullptr), inArcs(nullptr), wideInSources(false),
+      hasIncomingIndex(false)
+{
+
+}
+
+CSRGraph::CSRGraph(const std::string &fileName, bool verify, GraphArtifact *parent)
+    : CSRGraph(parent)
+{
+    open(fileName, verify);
+}
+
+CSRGraph::~CSRGraph()
+{
+
+}
+
+bool CSRGraph::open(const std::string &fileName, bool verify)
+{
+    close();
+    std::unique_ptr<MappedFile> f(new MappedFile(fileName, MappedFile::AccessPattern::Random));
+    if (!f->isOpen()) {
+        return fail(f->getLastError());
+    }
+    if (f->size() < sizeof(Header)) {
+        return fail("File too small.");
+    }
+    Header header;
+    std::memcpy(&header, f->begin(), sizeof(Header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        return fail("Not a binary graph file.");
+    }
+    if (header.version != VERSION) {
+        return fail("Unsupported format version " + std::to_string(header.version) + ".");
+    }
+    if (!hasValidCounts(header) || fileSize(header) != f->size()) {
+        return fail("Unexpected file size.");
+    }
+
+    numVertices = header.numVertices;
+    numArcs = header.numArcs;
+    wideIndices = header.flags & WideIndices;
+    auto indices = paddedSize(numArcs * indexSize(header.flags));
+    const char *p = f->begin() + sizeof(Header);
+    outOffsets = reinterpret_cast<const std::uint64_t*>(p);
+    p += (numVertices + 1U) * 8U;
+    outTargets = p;
+    p += indices;
+    if (header.flags & HasArcIds) {
+        arcIds = reinterpret_cast<const std::uint64_t*>(p);
+        p += numArcs * 8U;
+    }
+    if (header.flags & HasArcWeights) {
+        arcWeights = reinterpret_cast<const double*>(p);
+        p += numArcs * 8U;
+    }
+    if (header.flags & HasIncomingIndex) {
+        inOffsets = reinterpret_cast<const std::uint64_t*>(p);
+        p += (numVertices + 1U) * 8U;
+        inSources = p;
+        wideInSources = wideIndices;
+        p += indices;
+        inArcs = reinterpret_cast<const std::uint64_t*>(p);
+        hasIncomingIndex = true;
+    }
+    file = std::move(f);
+
+    if (verify && !verifyContents()) {
+        close();
+        return false;
+    }
+    if (!createArtifacts()) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool CSRGraph::createArtifacts()
+{
+    try {
+        std::unique_ptr<Artifacts> created(new Artifacts);
+        created->vertices.reserve(numVertices);
+        for (index_type v = 0U; v < numVertices; v++) {
+            created->vertices.emplace_back(v, this);
+        }
+        created->arcs.reserve(numArcs);
+        if (outOffsets[0] != 0U || outOffsets[numVertices] != numArcs) {
+            return fail("Illegal offsets.");
+        }
+        for (index_type u = 0U; u < numVertices; u++) {
+            if (outOffsets[u + 1U] < outOffsets[u]) {
+                return fail("Illegal offsets.");
+            }
+            Vertex *tail = &created->vertices[u];
+            for (auto k = outOffsets[u]; k < outOffsets[u + 1U]; k++) {
+                auto v = getTarget(k);
+                if (v >= numVertices) {
+                    return fail("Illegal index.");
+                }
+                created->arcs.emplace_back(tail, &created->vertices[v], arcIds ? arcIds[k] : k, this, k);
+            }
+        }
+        artifacts = std::move(created);
+    } catch (const std::length_error &) {
+        return fail("Not enough memory for the graph.");
+    } catch (const std::bad_alloc &) {
+        return fail("Not enough memory for the graph.");
+    }
+    return true;
+}
+
+void CSRGraph::close()
+{
+    transposed.clear();
+    transposed.shrink_to_fit();
+    numVertices = 0U;
+    numArcs = 0U;
+    outOffsets = nullptr;
+    outTargets = nullptr;
+    arcIds = nullptr;
+    arcWeights = nullptr;
+    inOffsets = nullptr;
+    inSources = nullptr;
+    inArcs = nullptr;
+    hasIncomingIndex = false;
+    artifacts.reset();
+    file.reset();
+}
+
+CSRGraph::index_type CSRGraph::getArcIndex(const Arc *a) const
+{
+    return static_cast<const CSRArc*>(a)->getIndex();
+}
+
+Vertex *CSRGraph::vertexAt(index_type v) const
+{
+    return &artifacts->vertices[v];
+}
+
+Arc *CSRGraph::arcAt(index_type k) const
+{
+    return &artifacts->arcs[k];
+}
+
+Vertex *CSRGraph::addVertex()
+{
+    throw std::logic_error("CSRGraph is read-only.");
+}
+
+void CSRGraph::removeVertex(Vertex *)
+{
+    throw std::logic_error("CSRGraph is read-only.");
+}
+
+bool CSRGraph::containsVertex(const Vertex *v) const
+{
+    return v->getParent() == this && getIndex(v) < numVertices;
+}
+
+Vertex *CSRGraph::getAnyVertex() const
+{
+    if (numVertices == 0U) {
+        return nullptr;
+    }
+    return vertexAt(0U);
+}
+
+void CSRGraph::mapVerticesUntil(const VertexMapping &vvFun, const VertexPredicate &breakCondition)
+{
+    for (index_type i = 0U; i < numVertices; i++) {
+        Vertex *v = vertexAt(i);
+        if (breakCondition(v)) {
+            break;
+        }
+        vvFun(v);
+    }
+}
+
+bool CSRGraph::isEmpty() const
+{
+    return numVertices == 0U;
+}
+
+Graph::size_type CSRGraph::getSize() const
+{
+    return numVertices;
+}
+
+Arc *CSRGraph::addArc(Vertex *, Vertex *)
+{
+    throw std::logic_error("CSRGraph is read-only.");
+}
+
+MultiArc *CSRGraph::addMultiArc(Vertex *, Vertex *, Graph::size_type)
+{
+    throw std::logic_error("CSRGraph is read-only.");
+}
+
+void CSRGraph::removeArc(Arc *)
+{
+    throw std::logic_error("CSRGraph is read-only.");
+}
+
+bool CSRGraph::containsArc(const Arc *a) const
+{
+    return a->getParent() == this && getArcIndex(a) < numArcs;
+}
+
+Arc *CSRGraph::findArc(const Vertex *from, const Vertex *to) const
+{
+    auto u = getIndex(from);
+    auto v = getIndex(to);
+    for (auto k = outOffsets[u]; k < outOffsets[u + 1U]; k++) {
+        if (getTarget(k) == v) {
+            return arcAt(k);
+        }
+    }
+    return nullptr;
+}
+
+Graph::size_type CSRGraph::getOutDegree(const Vertex *v, bool) const
+{
+    auto i = getIndex(v);
+    return outOffsets[i + 1U] - outOffsets[i];
+}
+
+Graph::size_type CSRGraph::getInDegree(const Vertex *v, bool) const
+{
+    requireIncomingIndex();
+    auto i = getIndex(v);
+    return inOffsets[i + 1U] - inOffsets[i];
+}
+
+Graph::size_type CSRGraph::getNumArcs(bool) const
+{
+    return numArcs;
+}
+
+void CSRGraph::mapArcsUntil(const ArcMapping &avFun, const ArcPredicate &breakCondition)
+{
+    for (index_type k = 0U; k < numArcs; k++) {
+        Arc *a = arcAt(k);
+        if (breakCondition(a)) {
+            break;
+        }
+        avFun(a);
+    }
+}
+
+void CSRGraph::mapOutgoingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition)
+{
+    auto i = getIndex(v);
+    for (auto k = outOffsets[i]; k < outOffsets[i + 1U]; k++) {
+        Arc *a = arcAt(k);
+        if (breakCondition(a)) {
+            break;
+        }
+        avFun(a);
+    }
+}
+
+void CSRGraph::mapIncomingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition)
+{
+    requireIncomingIndex();
+    auto i = getIndex(v);
+    for (auto k = inOffsets[i]; k < inOffsets[i + 1U]; k++) {
+        Arc *a = arcAt(inArcs[k]);
+        if (breakCondition(a)) {
+            break;
+        }
+        avFun(a);
+    }
+}
+
+void CSRGraph::clear()
+{
+    close();
+    DiGraph::clear();
+}
+
+MemoryReport CSRGraph::memoryUsage() const
+{
+    MemoryReport report;
+    if (file) {
+        report.add("mapped file", MemoryUsage(file->size(), file->size()));
+    }
+    report.add("incoming index", MemoryUsage::of(transposed));
+    if (artifacts) {
+        report.add("vertices", MemoryUsage::of(artifacts->vertices));
+        report.add("arcs", MemoryUsage::of(artifacts->arcs));
+    }
+    report.add(DiGraph::memoryUsage());
+    return report;
+}
+
+std::string CSRGraph::toString() const
+{
+    return "CSRGraph (" + std::to_string(numVertices) + " vertices, "
+            + std::to_string(numArcs) + " arcs)";
+}
+
+bool CSRGraph::fail(const std::string &error)
+{
+    lastError = error;
+    return false;
+}
+
+bool CSRGraph::verifyContents() const
+{
+    Checksum checksum;
+    auto words = (file->size() - 8U) / 8U;
+    checksum.add(file->begin(), words);
+    std::uint64_t stored;
+    std::memcpy(&stored, file->end() - 8U, sizeof(stored));
+    if (checksum.get() != stored) {
+        return const_cast<CSRGraph*>(this)->fail("Checksum mismatch.");
+    }
+    auto validOffsets = [this](const std::uint64_t *offsets) {
+        return offsets[0] == 0U && offsets[numVertices] == numArcs
+                && std::is_sorted(offsets, offsets + numVertices + 1U);
+    };
+    if (!validOffsets(outOffsets) || (inOffsets && !validOffsets(inOffsets))) {
+        return const_cast<CSRGraph*>(this)->fail("Illegal offsets.");
+    }
+    for (index_type k = 0U; k < numArcs; k++) {
+        if (getTarget(k) >= numVertices || (inSources && getSource(k) >= numVertices)
+                || (inArcs && inArcs[k] >= numArcs)) {
+            return const_cast<CSRGraph*>(this)->fail("Illegal index.");
+        }
+    }
+    return true;
+}
+
+void CSRGraph::requireIncomingIndex() const
+{
+    if (hasIncomingIndex.load(std::memory_order_acquire)) {
+        return;
+    }
+    CSRGraph *me = const_cast<CSRGraph*>(this);
+    std::lock_guard<std::mutex> lock(me->incomingIndexMutex);
+    if (!hasIncomingIndex.load(std::memory_order_relaxed)) {
+        me->buildIncomingIndex();
+        me->hasIncomingIndex.store(true, std::memory_order_release);
+    }
+}
+
+void CSRGraph::buildIncomingIndex()
+{
+    // layout: offsets, sources, arc indices
+    transposed.assign(numVertices + 1U + 2U * numArcs, 0U);
+    std::uint64_t *offsets = transposed.data();
+    std::uint64_t *sources = offsets + numVertices + 1U;
+    std::uint64_t *arcIndices = sources + numArcs;
+    for (index_type k = 0U; k < numArcs; k++) {
+        offsets[getTarget(k) + 1U]++;
+    }
+    for (index_type v = 0U; v < numVertices; v++) {
+        offsets[v + 1U] += offsets[v];
+    }
+    std::vector<std::uint64_t> next(offsets, offsets + numVertices);
+    for (index_type u = 0U; u < numVertices; u++) {
+        for (auto k = outOffsets[u]; k < outOffsets[u + 1U]; k++) {
+            auto pos = next[getTarget(k)]++;
+            sources[pos] = u;
+            arcIndices[pos] = k;
+        }
+    }
+    inOffsets = offsets;
+    inSources = sources;
+    inArcs = arcIndices;
+    wideInSources = true;
+}
+
+}
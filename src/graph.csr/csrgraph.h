@@ -0,0 +1,158 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef CSRGRAPH_H
+#define CSRGRAPH_H
+
+#include "graph/digraph.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Algora {
+
+class MappedFile;
+
+// Read-only graph served directly from a memory-mapped file in the native
+// binary format (see io/binarygraphformat.h).
+// One vertex object per vertex and one arc object per arc are created when
+// the file is opened (about 64 and 88 bytes each), so that pointers are
+// stable and unique as for any other DiGraph; the adjacency structure itself
+// stays in the file. Vertex ids equal their indices.
+// Code that needs no objects can work on the raw compressed sparse row
+// arrays via getOffset(), getTarget() etc. instead.
+// Concurrent reads are safe. All modifying methods throw std::logic_error.
+class CSRGraph : public DiGraph
+{
+public:
+    typedef std::uint64_t index_type;
+
+    explicit CSRGraph(GraphArtifact *parent = nullptr);
+    explicit CSRGraph(const std::string &fileName, bool verify = false, GraphArtifact *parent = nullptr);
+    virtual ~CSRGraph() override;
+
+    CSRGraph(const CSRGraph &other) = delete;
+    CSRGraph &operator=(const CSRGraph &other) = delete;
+
+    // maps the given file and checks the outgoing offsets and targets while
+    // creating the artifacts; verify additionally checks the checksum and
+    // the incoming index
+    bool open(const std::string &fileName, bool verify = false);
+    void close();
+    bool isOpen() const { return file != nullptr; }
+    const std::string &getLastError() const { return lastError; }
+
+    bool hasArcIds() const { return arcIds != nullptr; }
+    bool hasArcWeights() const { return arcWeights != nullptr; }
+    double getArcWeight(const Arc *a) const { return arcWeights[getArcIndex(a)]; }
+
+    // raw access, arcs are numbered by their position in the target array
+    index_type getNumVertices() const { return numVertices; }
+    index_type getOffset(index_type v) const { return outOffsets[v]; }
+    index_type getTarget(index_type k) const {
+        return wideIndices ? static_cast<const std::uint64_t*>(outTargets)[k]
+                           : static_cast<const std::uint32_t*>(outTargets)[k];
+    }
+    double getArcWeightAt(index_type k) const { return arcWeights[k]; }
+    Vertex *vertexAt(index_type v) const;
+    index_type getIndex(const Vertex *v) const { return v->getId(); }
+    index_type getArcIndex(const Arc *a) const;
+    Arc *arcAt(index_type k) const;
+
+    // Graph interface
+public:
+    virtual Vertex *addVertex() override;
+    virtual void removeVertex(Vertex *v) override;
+    virtual bool containsVertex(const Vertex *v) const override;
+    virtual Vertex *getAnyVertex() const override;
+    virtual void mapVerticesUntil(const VertexMapping &vvFun, const VertexPredicate &breakCondition) override;
+    virtual bool isEmpty() const override;
+    virtual size_type getSize() const override;
+
+    // DiGraph interface
+public:
+    using DiGraph::mapArcs;
+    using DiGraph::mapOutgoingArcs;
+    using DiGraph::mapIncomingArcs;
+
+    virtual Arc *addArc(Vertex *tail, Vertex *head) override;
+    virtual MultiArc *addMultiArc(Vertex *tail, Vertex *head, size_type size) override;
+    virtual void removeArc(Arc *a) override;
+    virtual bool containsArc(const Arc *a) const override;
+    virtual Arc *findArc(const Vertex *from, const Vertex *to) const override;
+    virtual size_type getOutDegree(const Vertex *v, bool multiArcsAsSimple = false) const override;
+    virtual size_type getInDegree(const Vertex *v, bool multiArcsAsSimple = false) const override;
+    virtual size_type getNumArcs(bool multiArcsAsSimple = false) const override;
+    virtual void mapArcsUntil(const ArcMapping &avFun, const ArcPredicate &breakCondition) override;
+    virtual void mapOutgoingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition) override;
+    virtual void mapIncomingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition) override;
+    virtual void clear() override;
+
+    // the mapped file is reported as a part of its own, it is not heap memory
+    virtual MemoryReport memoryUsage() const override;
+
+    // GraphArtifact interface
+public:
+    virtual std::string toString() const override;
+
+private:
+    struct Artifacts;
+
+    std::unique_ptr<MappedFile> file;
+    std::unique_ptr<Artifacts> artifacts;
+    std::string lastError;
+
+    index_type numVertices;
+    index_type numArcs;
+    bool wideIndices;
+    const std::uint64_t *outOffsets;
+    const void *outTargets;
+    const std::uint64_t *arcIds;
+    const double *arcWeights;
+
+    // incoming index, either mapped or built on demand
+    const std::uint64_t *inOffsets;
+    const void *inSources;
+    const std::uint64_t *inArcs;
+    bool wideInSources;
+    std::vector<std::uint64_t> transposed;
+    std::atomic<bool> hasIncomingIndex;
+    std::mutex incomingIndexMutex;
+
+    bool fail(const std::string &error);
+    bool verifyContents() const;
+    bool createArtifacts();
+    void requireIncomingIndex() const;
+    void buildIncomingIndex();
+    index_type getSource(index_type k) const {
+        return wideInSources ? static_cast<const std::uint64_t*>(inSources)[k]
+                             : static_cast<const std::uint32_t*>(inSources)[k];
+    }
+};
+
+}
+
+#endif // CSRGRAPH_H
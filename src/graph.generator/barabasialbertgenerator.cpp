@@ -0,0 +1,60 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "barabasialbertgenerator.h"
+
+namespace Algora {
+
+BarabasiAlbertGenerator::BarabasiAlbertGenerator(id_type numVertices, id_type arcsPerVertex,
+                                                 std::uint64_t seed)
+    : GraphGenerator(seed), n(numVertices), k(arcsPerVertex)
+{
+
+}
+
+GraphGenerator::ArcList BarabasiAlbertGenerator::generateArcs() const
+{
+    ArcList arcs;
+    if (n < 2U) {
+        return arcs;
+    }
+    arcs.reserve((n - 1U) * k);
+    // every vertex appears once per incident arc; the first vertex gets one
+    // extra entry so that the second one has a target
+    std::vector<id_type> endpoints;
+    endpoints.reserve(2U * (n - 1U) * k + 1U);
+    endpoints.push_back(0U);
+    RandomEngine rnd = engine(0U, 0U);
+    for (id_type v = 1U; v < n; v++) {
+        std::uniform_int_distribution<std::size_t> pick(0U, endpoints.size() - 1U);
+        for (id_type i = 0U; i < k; i++) {
+            arcs.emplace_back(v, endpoints[pick(rnd)]);
+        }
+        for (auto a = arcs.end() - static_cast<std::ptrdiff_t>(k); a != arcs.end(); a++) {
+            endpoints.push_back(a->first);
+            endpoints.push_back(a->second);
+        }
+    }
+    return arcs;
+}
+
+}
@@ -0,0 +1,52 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef BARABASIALBERTGENERATOR_H
+#define BARABASIALBERTGENERATOR_H
+
+#include "graphgenerator.h"
+
+namespace Algora {
+
+// Barabási–Albert preferential attachment: vertices are added one by one and
+// each vertex but the first gets arcsPerVertex arcs to earlier vertices,
+// chosen with probability proportional to their degree. There are no loops,
+// but a vertex may pick the same target more than once.
+// Generation is sequential (Batagelj and Brandes, 2005), as every vertex
+// depends on all earlier ones.
+class BarabasiAlbertGenerator : public GraphGenerator
+{
+public:
+    BarabasiAlbertGenerator(id_type numVertices, id_type arcsPerVertex, std::uint64_t seed = 0U);
+    virtual ~BarabasiAlbertGenerator() override { }
+
+    virtual id_type getNumVertices() const override { return n; }
+    virtual ArcList generateArcs() const override;
+
+private:
+    id_type n;
+    id_type k;
+};
+
+}
+
+#endif // BARABASIALBERTGENERATOR_H
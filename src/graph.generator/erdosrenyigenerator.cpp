@@ -0,0 +1,53 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "erdosrenyigenerator.h"
+
+#include <stdexcept>
+
+namespace Algora {
+
+ErdosRenyiGenerator::ErdosRenyiGenerator(id_type numVertices, id_type numArcs, bool simple,
+                                         std::uint64_t seed)
+    : GraphGenerator(seed), n(numVertices), m(numArcs), simple(simple)
+{
+    if (m > 0U && n == 0U) {
+        throw std::invalid_argument("Cannot generate arcs without vertices.");
+    }
+    if (simple && n < (1ULL << 32) && m > n * (n - 1U)) {
+        throw std::invalid_argument("Too many arcs for a simple graph.");
+    }
+}
+
+GraphGenerator::ArcList ErdosRenyiGenerator::generateArcs() const
+{
+    ArcList arcs;
+    id_type maxIndex = n > 0U ? n - 1U : 0U;
+    sampleArcs(arcs, m, [maxIndex](RandomEngine &rnd, std::pair<id_type, id_type> &arc) {
+        std::uniform_int_distribution<id_type> vertex(0U, maxIndex);
+        arc.first = vertex(rnd);
+        arc.second = vertex(rnd);
+    }, simple);
+    return arcs;
+}
+
+}
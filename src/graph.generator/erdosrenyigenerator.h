@@ -0,0 +1,51 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef ERDOSRENYIGENERATOR_H
+#define ERDOSRENYIGENERATOR_H
+
+#include "graphgenerator.h"
+
+namespace Algora {
+
+// G(n, m): m arcs chosen uniformly at random. If simple, the graph has
+// neither loops nor multiarcs, which requires m <= n(n-1); otherwise, arcs
+// are drawn independently.
+class ErdosRenyiGenerator : public GraphGenerator
+{
+public:
+    ErdosRenyiGenerator(id_type numVertices, id_type numArcs, bool simple = true,
+                        std::uint64_t seed = 0U);
+    virtual ~ErdosRenyiGenerator() override { }
+
+    virtual id_type getNumVertices() const override { return n; }
+    virtual ArcList generateArcs() const override;
+
+private:
+    id_type n;
+    id_type m;
+    bool simple;
+};
+
+}
+
+#endif // ERDOSRENYIGENERATOR_H
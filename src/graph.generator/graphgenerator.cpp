@@ -0,0 +1,133 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "graphgenerator.h"
+
+#include "graph/digraph.h"
+#include "io/binarygraphrw.h"
+#include "io/bulkgraphbuilder.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace Algora {
+
+namespace {
+
+std::uint64_t splitMix(std::uint64_t x)
+{
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+}
+
+void GraphGenerator::writeBinary(std::ostream &out, bool incomingIndex) const
+{
+    BinaryGraphRW writer(false, incomingIndex);
+    writer.setOutputStream(&out);
+    writer.writeArcs(getNumVertices(), generateArcs());
+}
+
+bool GraphGenerator::provideDiGraph(DiGraph *graph)
+{
+    BulkGraphBuilder builder;
+    builder.setNumVertices(getNumVertices());
+    builder.setArcs(generateArcs());
+    bool built = builder.build(graph);
+    vertices = builder.getVertices();
+    return built;
+}
+
+GraphGenerator::RandomEngine GraphGenerator::engine(std::uint64_t round, std::uint64_t chunk) const
+{
+    return RandomEngine(splitMix(seed ^ splitMix(round ^ splitMix(chunk))));
+}
+
+void GraphGenerator::fillChunks(ArcList &arcs, id_type first, id_type count, std::uint64_t round,
+                                const ChunkFunction &fill) const
+{
+    if (arcs.size() < first + count) {
+        arcs.resize(first + count);
+    }
+    id_type numChunks = (count + CHUNK_SIZE - 1U) / CHUNK_SIZE;
+    std::atomic<id_type> nextChunk(0U);
+    auto work = [&]() {
+        for (id_type c = nextChunk++; c < numChunks; c = nextChunk++) {
+            RandomEngine rnd = engine(round, c);
+            id_type begin = first + c * CHUNK_SIZE;
+            fill(rnd, begin, std::min(begin + CHUNK_SIZE, first + count));
+        }
+    };
+
+    unsigned int threads = numThreads;
+    if (threads == 0U) {
+        threads = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    if (threads > numChunks) {
+        threads = static_cast<unsigned int>(numChunks);
+    }
+    if (threads <= 1U) {
+        work();
+        return;
+    }
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (auto t = 0U; t < threads; t++) {
+        workers.emplace_back(work);
+    }
+    for (std::thread &t : workers) {
+        t.join();
+    }
+}
+
+void GraphGenerator::sampleArcs(ArcList &arcs, id_type m, const ArcSampler &sample, bool simple) const
+{
+    auto fill = [&arcs,&sample](RandomEngine &rnd, id_type begin, id_type end) {
+        for (auto i = begin; i < end; i++) {
+            sample(rnd, arcs[i]);
+        }
+    };
+    arcs.clear();
+    arcs.reserve(m);
+    fillChunks(arcs, 0U, m, 0U, fill);
+    if (!simple) {
+        return;
+    }
+
+    for (std::uint64_t round = 1U; ; round++) {
+        arcs.erase(std::remove_if(arcs.begin(), arcs.end(),
+                                  [](const std::pair<id_type, id_type> &a) { return a.first == a.second; }),
+                   arcs.end());
+        std::sort(arcs.begin(), arcs.end());
+        arcs.erase(std::unique(arcs.begin(), arcs.end()), arcs.end());
+        if (arcs.size() >= m) {
+            break;
+        }
+        fillChunks(arcs, arcs.size(), m - arcs.size(), round, fill);
+    }
+}
+
+}
@@ -0,0 +1,103 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef GRAPHGENERATOR_H
+#define GRAPHGENERATOR_H
+
+#include "pipe/digraphprovider.h"
+
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace Algora {
+
+class Vertex;
+
+// Base class of synthetic graph generators. A generator produces a list of
+// arcs between vertex indices 0, ..., getNumVertices() - 1, which can be
+// built into a graph in one transaction or written to a binary graph file
+// without building a graph at all.
+// Arcs are generated in fixed-size chunks, each with its own random number
+// generator seeded from the seed and the chunk index only, so the result is
+// the same for every number of threads (given the same standard library).
+class GraphGenerator : public DiGraphProvider
+{
+public:
+    typedef std::uint64_t id_type;
+    typedef std::vector<std::pair<id_type, id_type>> ArcList;
+    typedef std::mt19937_64 RandomEngine;
+
+    explicit GraphGenerator(std::uint64_t seed = 0U, unsigned int numThreads = 0U)
+        : seed(seed), numThreads(numThreads) { }
+    virtual ~GraphGenerator() override { }
+
+    void setSeed(std::uint64_t s) { seed = s; }
+    std::uint64_t getSeed() const { return seed; }
+    // 0 means one thread per hardware thread
+    void setNumThreads(unsigned int n) { numThreads = n; }
+
+    virtual id_type getNumVertices() const = 0;
+    virtual ArcList generateArcs() const = 0;
+
+    // writes the generated graph in the native binary format;
+    // the stream must be opened in binary mode
+    void writeBinary(std::ostream &out, bool incomingIndex = true) const;
+
+    // vertices of the last graph provided, vertex i has index i
+    const std::vector<Vertex*> &getVertices() const { return vertices; }
+
+    // DiGraphProvider interface
+public:
+    virtual bool isGraphAvailable() override { return true; }
+    // false if memory ran out, graph may then hold some of the vertices
+    virtual bool provideDiGraph(DiGraph *graph) override;
+
+protected:
+    static const id_type CHUNK_SIZE = 1U << 16;
+
+    // fills arcs[first, first + count) chunk-wise in parallel,
+    // fill(rnd, begin, end) must set arcs[begin, end)
+    typedef std::function<void(RandomEngine &rnd, id_type begin, id_type end)> ChunkFunction;
+    void fillChunks(ArcList &arcs, id_type first, id_type count, std::uint64_t round,
+                    const ChunkFunction &fill) const;
+
+    // generates m arcs by calling sample(rnd, arc) for each; with simple set,
+    // loops and multiarcs are removed and arcs are resampled until there are
+    // m distinct ones, sorted by tail and head
+    typedef std::function<void(RandomEngine &rnd, std::pair<id_type, id_type> &arc)> ArcSampler;
+    void sampleArcs(ArcList &arcs, id_type m, const ArcSampler &sample, bool simple) const;
+
+    RandomEngine engine(std::uint64_t round, std::uint64_t chunk) const;
+
+private:
+    std::uint64_t seed;
+    unsigned int numThreads;
+    std::vector<Vertex*> vertices;
+};
+
+}
+
+#endif // GRAPHGENERATOR_H
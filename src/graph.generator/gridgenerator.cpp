@@ -0,0 +1,62 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "gridgenerator.h"
+
+namespace Algora {
+
+GridGenerator::GridGenerator(id_type rows, id_type columns, bool bidirectional)
+    : rows(rows), columns(columns), bidirectional(bidirectional)
+{
+
+}
+
+GraphGenerator::ArcList GridGenerator::generateArcs() const
+{
+    ArcList arcs;
+    if (rows == 0U || columns == 0U) {
+        return arcs;
+    }
+    id_type horizontal = rows * (columns - 1U);
+    id_type vertical = (rows - 1U) * columns;
+    id_type m = horizontal + vertical;
+    id_type c = columns;
+    fillChunks(arcs, 0U, bidirectional ? 2U * m : m, 0U,
+               [&arcs,horizontal,m,c](RandomEngine &, id_type begin, id_type end) {
+        for (auto i = begin; i < end; i++) {
+            auto j = i < m ? i : i - m;
+            id_type tail;
+            id_type head;
+            if (j < horizontal) {
+                tail = (j / (c - 1U)) * c + j % (c - 1U);
+                head = tail + 1U;
+            } else {
+                tail = j - horizontal;
+                head = tail + c;
+            }
+            arcs[i] = i < m ? std::make_pair(tail, head) : std::make_pair(head, tail);
+        }
+    });
+    return arcs;
+}
+
+}
@@ -0,0 +1,50 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef GRIDGENERATOR_H
+#define GRIDGENERATOR_H
+
+#include "graphgenerator.h"
+
+namespace Algora {
+
+// rows x columns grid, vertex r * columns + c in row r and column c.
+// Arcs point right and down; with bidirectional set, every arc also has
+// its reverse.
+class GridGenerator : public GraphGenerator
+{
+public:
+    GridGenerator(id_type rows, id_type columns, bool bidirectional = false);
+    virtual ~GridGenerator() override { }
+
+    virtual id_type getNumVertices() const override { return rows * columns; }
+    virtual ArcList generateArcs() const override;
+
+private:
+    id_type rows;
+    id_type columns;
+    bool bidirectional;
+};
+
+}
+
+#endif // GRIDGENERATOR_H
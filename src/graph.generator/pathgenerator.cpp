@@ -0,0 +1,52 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "pathgenerator.h"
+
+namespace Algora {
+
+PathGenerator::PathGenerator(id_type numVertices, bool cycle, bool bidirectional)
+    : n(numVertices), cycle(cycle), bidirectional(bidirectional)
+{
+
+}
+
+GraphGenerator::ArcList PathGenerator::generateArcs() const
+{
+    ArcList arcs;
+    if (n == 0U) {
+        return arcs;
+    }
+    id_type m = cycle ? n : n - 1U;
+    id_type numVertices = n;
+    fillChunks(arcs, 0U, bidirectional ? 2U * m : m, 0U,
+               [&arcs,m,numVertices](RandomEngine &, id_type begin, id_type end) {
+        for (auto i = begin; i < end; i++) {
+            auto tail = i < m ? i : i - m;
+            auto head = tail + 1U < numVertices ? tail + 1U : 0U;
+            arcs[i] = i < m ? std::make_pair(tail, head) : std::make_pair(head, tail);
+        }
+    });
+    return arcs;
+}
+
+}
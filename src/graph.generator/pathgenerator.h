@@ -0,0 +1,50 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef PATHGENERATOR_H
+#define PATHGENERATOR_H
+
+#include "graphgenerator.h"
+
+namespace Algora {
+
+// Path 0 -> 1 -> ... -> n-1, closed to a cycle by an arc n-1 -> 0 if cycle
+// is set. With bidirectional set, every arc also has its reverse.
+// Long paths are the worst case for recursive or level-synchronous traversals.
+class PathGenerator : public GraphGenerator
+{
+public:
+    explicit PathGenerator(id_type numVertices, bool cycle = false, bool bidirectional = false);
+    virtual ~PathGenerator() override { }
+
+    virtual id_type getNumVertices() const override { return n; }
+    virtual ArcList generateArcs() const override;
+
+private:
+    id_type n;
+    bool cycle;
+    bool bidirectional;
+};
+
+}
+
+#endif // PATHGENERATOR_H
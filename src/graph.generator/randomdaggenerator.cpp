@@ -0,0 +1,77 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "randomdaggenerator.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+namespace Algora {
+
+RandomDagGenerator::RandomDagGenerator(id_type numVertices, id_type numArcs, bool shuffle,
+                                       std::uint64_t seed)
+    : GraphGenerator(seed), n(numVertices), m(numArcs), shuffle(shuffle)
+{
+    if (n < (1ULL << 32) && m > n * (n - 1U) / 2U) {
+        throw std::invalid_argument("Too many arcs for a simple DAG.");
+    }
+}
+
+GraphGenerator::ArcList RandomDagGenerator::generateArcs() const
+{
+    ArcList arcs;
+    if (n < 2U) {
+        return arcs;
+    }
+    // sample pairs of positions in the topological order
+    id_type maxIndex = n - 1U;
+    sampleArcs(arcs, m, [maxIndex](RandomEngine &rnd, std::pair<id_type, id_type> &arc) {
+        std::uniform_int_distribution<id_type> position(0U, maxIndex);
+        auto p = position(rnd);
+        auto q = position(rnd);
+        arc = p < q ? std::make_pair(p, q) : std::make_pair(q, p);
+    }, true);
+
+    if (shuffle) {
+        auto order = getTopologicalOrder();
+        for (auto &a : arcs) {
+            a.first = order[a.first];
+            a.second = order[a.second];
+        }
+    }
+    return arcs;
+}
+
+std::vector<GraphGenerator::id_type> RandomDagGenerator::getTopologicalOrder() const
+{
+    std::vector<id_type> order(n);
+    std::iota(order.begin(), order.end(), id_type(0U));
+    if (shuffle) {
+        // own stream, independent of the arc chunks
+        RandomEngine rnd = engine(~std::uint64_t(0U), 0U);
+        std::shuffle(order.begin(), order.end(), rnd);
+    }
+    return order;
+}
+
+}
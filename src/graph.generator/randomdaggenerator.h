@@ -0,0 +1,55 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef RANDOMDAGGENERATOR_H
+#define RANDOMDAGGENERATOR_H
+
+#include "graphgenerator.h"
+
+namespace Algora {
+
+// Random simple DAG with m arcs, chosen uniformly among all DAGs with the
+// same topological order. This order is a random permutation of the vertex
+// indices if shuffle is set, and 0, 1, ..., n-1 otherwise.
+// Requires m <= n(n-1)/2.
+class RandomDagGenerator : public GraphGenerator
+{
+public:
+    RandomDagGenerator(id_type numVertices, id_type numArcs, bool shuffle = true,
+                       std::uint64_t seed = 0U);
+    virtual ~RandomDagGenerator() override { }
+
+    virtual id_type getNumVertices() const override { return n; }
+    virtual ArcList generateArcs() const override;
+
+    // topological order of the generated DAG, depends only on n and the seed
+    std::vector<id_type> getTopologicalOrder() const;
+
+private:
+    id_type n;
+    id_type m;
+    bool shuffle;
+};
+
+}
+
+#endif // RANDOMDAGGENERATOR_H
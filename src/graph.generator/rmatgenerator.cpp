@@ -0,0 +1,74 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "rmatgenerator.h"
+
+#include <stdexcept>
+
+namespace Algora {
+
+RMatGenerator::RMatGenerator(unsigned int scale, id_type numArcs, double a, double b, double c,
+                             std::uint64_t seed)
+    : GraphGenerator(seed), scale(scale), m(numArcs), a(a), b(b), c(c)
+{
+    if (scale > 63U) {
+        throw std::invalid_argument("Scale must not exceed 63.");
+    }
+    if (a < 0.0 || b < 0.0 || c < 0.0 || a + b + c > 1.0) {
+        throw std::invalid_argument("Quadrant probabilities must be non-negative and sum up to at most 1.");
+    }
+}
+
+GraphGenerator::ArcList RMatGenerator::generateArcs() const
+{
+    ArcList arcs;
+    // one 64-bit random number decides two levels with 32-bit precision
+    auto threshold = [](double p) {
+        return static_cast<std::uint64_t>(p * 4294967296.0);
+    };
+    std::uint64_t ta = threshold(a);
+    std::uint64_t tab = threshold(a + b);
+    std::uint64_t tabc = threshold(a + b + c);
+    unsigned int levels = scale;
+    sampleArcs(arcs, m, [=](RandomEngine &rnd, std::pair<id_type, id_type> &arc) {
+        id_type tail = 0U;
+        id_type head = 0U;
+        std::uint64_t bits = 0U;
+        for (auto l = 0U; l < levels; l++) {
+            if (l % 2U == 0U) {
+                bits = rnd();
+            }
+            std::uint64_t r = bits & 0xFFFFFFFFULL;
+            bits >>= 32;
+            // branch-free quadrant selection, the outcome is unpredictable
+            id_type right = (r >= ta) ^ (r >= tab) ^ (r >= tabc);
+            id_type bottom = r >= tab;
+            tail = (tail << 1) | bottom;
+            head = (head << 1) | right;
+        }
+        arc.first = tail;
+        arc.second = head;
+    }, false);
+    return arcs;
+}
+
+}
@@ -0,0 +1,56 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef RMATGENERATOR_H
+#define RMATGENERATOR_H
+
+#include "graphgenerator.h"
+
+namespace Algora {
+
+// R-MAT (stochastic Kronecker graph with a 2x2 initiator): 2^scale vertices,
+// each arc picks one quadrant of the adjacency matrix per recursion level
+// with probabilities a (top left), b (top right), c (bottom left) and
+// 1 - a - b - c. The defaults are those of the Graph 500 benchmark.
+// Arcs are drawn independently, so there may be loops and multiarcs.
+class RMatGenerator : public GraphGenerator
+{
+public:
+    RMatGenerator(unsigned int scale, id_type numArcs,
+                  double a = 0.57, double b = 0.19, double c = 0.19,
+                  std::uint64_t seed = 0U);
+    virtual ~RMatGenerator() override { }
+
+    virtual id_type getNumVertices() const override { return id_type(1U) << scale; }
+    virtual ArcList generateArcs() const override;
+
+private:
+    unsigned int scale;
+    id_type m;
+    double a;
+    double b;
+    double c;
+};
+
+}
+
+#endif // RMATGENERATOR_H
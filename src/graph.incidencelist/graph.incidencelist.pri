@@ -25,9 +25,11 @@ message("pri file being processed: $$PWD")
 HEADERS += \ 
     $$PWD/incidencelistgraph.h \
     $$PWD/incidencelistvertex.h \
-    $$PWD/incidencelistgraphimplementation.h
+    $$PWD/incidencelistgraphimplementation.h \
+    $$PWD/inducedsubgraph.h
 
 SOURCES += \ 
     $$PWD/incidencelistgraph.cpp \
     $$PWD/incidencelistvertex.cpp \
-    $$PWD/incidencelistgraphimplementation.cpp
+    $$PWD/incidencelistgraphimplementation.cpp \
+    $$PWD/inducedsubgraph.cpp
@@ -70,8 +70,20 @@ IncidenceListGraph &IncidenceListGraph::assign(const IncidenceListGraph &other,
     return *this;
 }
 
+IncidenceListGraph &IncidenceListGraph::assignParallel(const IncidenceListGraph &other, unsigned int numThreads, FastPropertyMap<GraphArtifact *> *otherToThisVertices, FastPropertyMap<GraphArtifact *> *otherToThisArcs, FastPropertyMap<GraphArtifact *> *thisToOtherVertices, FastPropertyMap<GraphArtifact *> *thisToOtherArcs)
+{
+    if (&other == this) {
+        return *this;
+    }
+
+    DiGraph::operator=(other);
+    impl->assignParallel(*other.impl, numThreads, otherToThisVertices, otherToThisArcs, thisToOtherVertices, thisToOtherArcs);
+    return *this;
+}
+
 IncidenceListGraph::IncidenceListGraph(IncidenceListGraph &&other)
-    : DiGraph(std::move(other)), impl(other.impl)
+    : DiGraph(std::move(other)), impl(other.impl),
+      observableCompactions(std::move(other.observableCompactions))
 {
     impl->setOwner(this);
     other.impl = nullptr;
@@ -83,6 +95,7 @@ IncidenceListGraph &IncidenceListGraph::operator=(IncidenceListGraph &&other)
         return *this;
     }
     DiGraph::operator=(std::move(other));
+    observableCompactions = std::move(other.observableCompactions);
     impl->move(std::move(*other.impl), this);
     other.impl = nullptr;
     return *this;
@@ -148,6 +161,11 @@ void IncidenceListGraph::mapVerticesUntil(const VertexMapping &vvFun, const Vert
     impl->mapVertices(vvFun, breakCondition);
 }
 
+void IncidenceListGraph::mapVerticesUntil(const VertexMapping &vvFun, const VertexPredicate &breakCondition) const
+{
+    impl->mapVertices(vvFun, breakCondition);
+}
+
 Arc *IncidenceListGraph::addArc(Vertex *tail, Vertex *head)
 {
     auto t = castVertex(tail, this);
@@ -260,6 +278,47 @@ void IncidenceListGraph::mapIncomingArcsUntil(const Vertex *v, const ArcMapping
     impl->mapIncomingArcs(vertex, avFun, breakCondition);
 }
 
+void IncidenceListGraph::mapArcsUntil(const ArcMapping &avFun, const ArcPredicate &breakCondition) const
+{
+    impl->mapArcs(avFun, breakCondition);
+}
+
+void IncidenceListGraph::mapOutgoingArcsUntil(const Vertex *v, const ArcMapping &avFun,
+                                              const ArcPredicate &breakCondition) const
+{
+    auto vertex = castVertex(v, this);
+    impl->mapOutgoingArcs(vertex, avFun, breakCondition);
+}
+
+void IncidenceListGraph::mapIncomingArcsUntil(const Vertex *v, const ArcMapping &avFun,
+                                              const ArcPredicate &breakCondition) const
+{
+    auto vertex = castVertex(v, this);
+    impl->mapIncomingArcs(vertex, avFun, breakCondition);
+}
+
+void IncidenceListGraph::beginTransaction()
+{
+    DiGraph::beginTransaction();
+    // removed artifacts must not be recycled before observers have been notified
+    impl->holdRemovedArtifacts(true);
+}
+
+void IncidenceListGraph::commitTransaction()
+{
+    try {
+        DiGraph::commitTransaction();
+    } catch (...) {
+        if (!isInTransaction()) {
+            impl->holdRemovedArtifacts(false);
+        }
+        throw;
+    }
+    if (!isInTransaction()) {
+        impl->holdRemovedArtifacts(false);
+    }
+}
+
 bool IncidenceListGraph::isEmpty() const
 {
     return impl->isEmpty();
@@ -333,6 +392,43 @@ void IncidenceListGraph::reserveArcCapacity(size_type n)
    impl->reserveArcCapacity(n);
 }
 
+MemoryReport IncidenceListGraph::memoryUsage() const
+{
+    MemoryReport report = impl->memoryUsage();
+    report.add(DiGraph::memoryUsage());
+    report.add("observers", observableCompactions.memoryUsage());
+    return report;
+}
+
+void IncidenceListGraph::shrinkToFit()
+{
+    DiGraph::shrinkToFit();
+    observableCompactions.fit();
+    impl->shrinkToFit();
+}
+
+void IncidenceListGraph::compact()
+{
+    if (isInTransaction()) {
+        throw std::logic_error("Cannot compact during a transaction.");
+    }
+    IdMapping vertexIds;
+    IdMapping arcIds;
+    DiGraph::shrinkToFit();
+    impl->compact(vertexIds, arcIds);
+    observableCompactions.notifyObservers(vertexIds, arcIds);
+}
+
+void IncidenceListGraph::onCompaction(void *id, const CompactionMapping &fun)
+{
+    observableCompactions.addObserver(id, fun);
+}
+
+void IncidenceListGraph::removeOnCompaction(void *id)
+{
+    observableCompactions.removeObserver(id);
+}
+
 IncidenceListVertex *IncidenceListGraph::recycleOrCreateIncidenceListVertex()
 {
     return impl->recycleOrCreateIncidenceListVertex();
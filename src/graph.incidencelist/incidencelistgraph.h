@@ -24,6 +24,7 @@
 #define INCIDENCELISTGRAPH_H
 
 #include "graph/digraph.h"
+#include "graph/idmapping.h"
 
 namespace Algora {
 
@@ -31,6 +32,8 @@ class IncidenceListVertex;
 class IncidenceListGraphImplementation;
 template<typename T>
 class ModifiableProperty;
+template<typename T>
+class FastPropertyMap;
 
 class IncidenceListGraph : public DiGraph
 {
@@ -52,6 +55,14 @@ public:
                                      ModifiableProperty<GraphArtifact*> *thisToOtherVertices = nullptr,
                                      ModifiableProperty<GraphArtifact*> *thisToOtherArcs = nullptr
                                );
+    // Like assign(), but copies vertex ranges with numThreads threads (0: one per core)
+    // after allocating all vertices and arcs. The mappings are indexed by the ids of
+    // their keys and are reset first. Graphs with multi-arcs are copied sequentially.
+    IncidenceListGraph &assignParallel(const IncidenceListGraph &other, unsigned int numThreads = 0U,
+                                       FastPropertyMap<GraphArtifact*> *otherToThisVertices = nullptr,
+                                       FastPropertyMap<GraphArtifact*> *otherToThisArcs = nullptr,
+                                       FastPropertyMap<GraphArtifact*> *thisToOtherVertices = nullptr,
+                                       FastPropertyMap<GraphArtifact*> *thisToOtherArcs = nullptr);
 
     // moving
     IncidenceListGraph(IncidenceListGraph &&other);
@@ -92,6 +103,12 @@ public:
     virtual void mapOutgoingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition) override;
     virtual void mapIncomingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition) override;
 
+    virtual void beginTransaction() override;
+    virtual void commitTransaction() override;
+
+    virtual MemoryReport memoryUsage() const override;
+    virtual void shrinkToFit() override;
+
 public:
     void bundleParallelArcs();
     void unbundleParallelArcs();
@@ -99,6 +116,46 @@ public:
     void reserveVertexCapacity(size_type n);
     void reserveArcCapacity(size_type n);
 
+    // Releases pooled vertices and arcs and renumbers all ids densely, vertex ids
+    // become 0..n-1 in iteration order. Observers get the old-to-new mappings,
+    // e.g., to follow with a FastPropertyMap:
+    //   g.onCompaction(&m, [&m](const IdMapping &v, const IdMapping &) { m.permute(v); });
+    // Throws std::logic_error during a transaction.
+    void compact();
+
+    typedef std::function<void(const IdMapping &vertexIds, const IdMapping &arcIds)> CompactionMapping;
+    void onCompaction(void *id, const CompactionMapping &fun);
+    void removeOnCompaction(void *id);
+
+    // Read-only access
+    // Queries and traversals do not modify the graph or any index structure
+    // shared between callers. Hence, as long as no thread modifies the graph,
+    // any number of threads may traverse it concurrently, e.g., by running one
+    // BreadthFirstSearch each. Every thread needs its own algorithm instance and
+    // property maps, and no observers may be (un)registered meanwhile.
+    // The const overloads below make this contract explicit for callers
+    // holding a const reference.
+    using DiGraph::mapVertices;
+    using DiGraph::mapArcs;
+    using DiGraph::mapOutgoingArcs;
+    using DiGraph::mapIncomingArcs;
+    void mapVertices(const VertexMapping &vvFun) const {
+        mapVerticesUntil(vvFun, vertexFalse);
+    }
+    void mapVerticesUntil(const VertexMapping &vvFun, const VertexPredicate &breakCondition) const;
+    void mapArcs(const ArcMapping &avFun) const {
+        mapArcsUntil(avFun, arcFalse);
+    }
+    void mapArcsUntil(const ArcMapping &avFun, const ArcPredicate &breakCondition) const;
+    void mapOutgoingArcs(const Vertex *v, const ArcMapping &avFun) const {
+        mapOutgoingArcsUntil(v, avFun, arcFalse);
+    }
+    void mapOutgoingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition) const;
+    void mapIncomingArcs(const Vertex *v, const ArcMapping &avFun) const {
+        mapIncomingArcsUntil(v, avFun, arcFalse);
+    }
+    void mapIncomingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition) const;
+
 protected:
     IncidenceListVertex *recycleOrCreateIncidenceListVertex();
     IncidenceListVertex *createIncidenceListVertex();
@@ -107,6 +164,7 @@ protected:
 
 private:
     IncidenceListGraphImplementation *impl;
+    Observable<const IdMapping&, const IdMapping&> observableCompactions;
 };
 
 }
@@ -32,6 +32,7 @@
 #include <vector>
 #include <unordered_map>
 #include <algorithm>
+#include <thread>
 
 
 namespace Algora {
@@ -39,10 +40,30 @@ namespace Algora {
 template<typename... Args>
 bool any(Args... args) { return (... || args); }
 
+// runs fun(t, begin, end) for the consecutive ranges given by their bounds, one thread per range
+template<typename RangeFunction>
+void forEachRange(const std::vector<GraphArtifact::size_type> &bounds, const RangeFunction &fun)
+{
+    if (bounds.size() <= 2U) {
+        fun(0U, bounds.front(), bounds.back());
+        return;
+    }
+    std::vector<std::thread> threads;
+    threads.reserve(bounds.size() - 1U);
+    for (auto t = 0U; t + 1U < bounds.size(); t++) {
+        threads.emplace_back(fun, t, bounds[t], bounds[t + 1U]);
+    }
+    for (std::thread &t : threads) {
+        t.join();
+    }
+}
+
+static constexpr GraphArtifact::size_type MIN_VERTICES_PER_THREAD = 1024U;
+
 
 
 IncidenceListGraphImplementation::IncidenceListGraphImplementation(DiGraph *handle)
-    : graph(handle), numArcs(0U), nextVertexId(0U), nextArcId(0U)
+    : graph(handle), numArcs(0U), nextVertexId(0U), nextArcId(0U), holdRemoved(false)
 {
     sharedOutIndexMap.setDefaultValue(NO_INDEX);
     sharedInIndexMap.setDefaultValue(NO_INDEX);
@@ -61,7 +82,7 @@ IncidenceListGraphImplementation::IncidenceListGraphImplementation(const Inciden
                                                                    ModifiableProperty<GraphArtifact *> *otherToThisArcs,
                                                                    ModifiableProperty<GraphArtifact *> *thisToOtherVertices,
                                                                    ModifiableProperty<GraphArtifact *> *thisToOtherArcs)
-    : graph(nullptr), numArcs(0U), nextVertexId(0U), nextArcId(0U)
+    : graph(nullptr), numArcs(0U), nextVertexId(0U), nextArcId(0U), holdRemoved(false)
 {
     if (handle != nullptr) {
         graph = handle;
@@ -87,8 +108,9 @@ IncidenceListGraphImplementation &IncidenceListGraphImplementation::assign(const
     if (handle != nullptr) {
         graph = handle;
     }
+    // must live until copyFrom() is done
+    PropertyMap<GraphArtifact*> pm;
     if (any(otherToThisVertices == nullptr, otherToThisArcs == nullptr, thisToOtherVertices == nullptr, thisToOtherArcs == nullptr)) {
-        PropertyMap<GraphArtifact*> pm;
         otherToThisVertices = otherToThisVertices == nullptr ? &pm : otherToThisVertices;
         thisToOtherVertices = thisToOtherVertices == nullptr ? &pm : thisToOtherVertices;
         otherToThisArcs = otherToThisArcs == nullptr ? &pm : otherToThisArcs;
@@ -121,17 +143,167 @@ IncidenceListGraphImplementation &IncidenceListGraphImplementation::move(Inciden
     return *this;
 }
 
+void IncidenceListGraphImplementation::assignParallel(const IncidenceListGraphImplementation &other, unsigned int numThreads,
+                                                      FastPropertyMap<GraphArtifact *> *otherToThisVertices,
+                                                      FastPropertyMap<GraphArtifact *> *otherToThisArcs,
+                                                      FastPropertyMap<GraphArtifact *> *thisToOtherVertices,
+                                                      FastPropertyMap<GraphArtifact *> *thisToOtherArcs)
+{
+    if (&other == this) {
+        return;
+    }
+
+    auto n = other.vertices.size();
+    if (numThreads == 0U) {
+        numThreads = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    size_type maxThreads = n / MIN_VERTICES_PER_THREAD + 1U;
+    if (numThreads > maxThreads) {
+        numThreads = static_cast<unsigned int>(maxThreads);
+    }
+    std::vector<size_type> bounds(numThreads + 1U, 0U);
+    for (auto t = 0U; t <= numThreads; t++) {
+        bounds[t] = n * t / numThreads;
+    }
+
+    // count arcs per vertex; firstArc[i + 1] holds the out-degree of vertex i until summed up
+    std::vector<size_type> firstArc(n + 1U, 0U);
+    std::vector<id_type> arcIdBounds(numThreads, 0U);
+    std::vector<char> multiArcsFound(numThreads, false);
+    forEachRange(bounds, [&](unsigned int t, size_type begin, size_type end) {
+        for (auto i = begin; i < end; i++) {
+            auto *v = other.vertices[i];
+            if (v->hasMultiArcs()) {
+                multiArcsFound[t] = true;
+                return;
+            }
+            v->mapOutgoingArcs([&](Arc *a) {
+                firstArc[i + 1U]++;
+                arcIdBounds[t] = std::max(arcIdBounds[t], a->getId() + 1U);
+            });
+        }
+    });
+    // multi-arcs and bundles are rare, their positions cannot be derived from the index maps
+    if (std::find(multiArcsFound.begin(), multiArcsFound.end(), true) != multiArcsFound.end()) {
+        PropertyMap<GraphArtifact*> pm;
+        auto mapOr = [&pm](FastPropertyMap<GraphArtifact*> *map) -> ModifiableProperty<GraphArtifact*>& {
+            if (map == nullptr) {
+                return pm;
+            }
+            map->resetAll(0U);
+            return *map;
+        };
+        copyFrom(other, mapOr(otherToThisVertices), mapOr(otherToThisArcs),
+                 mapOr(thisToOtherVertices), mapOr(thisToOtherArcs));
+        return;
+    }
+
+    clear(true);
+
+    id_type vertexIdBound = 0U;
+    for (auto i = 0ULL; i < n; i++) {
+        firstArc[i + 1U] += firstArc[i];
+        vertexIdBound = std::max(vertexIdBound, other.vertices[i]->getId() + 1U);
+    }
+    auto m = firstArc[n];
+    auto arcIdBound = *std::max_element(arcIdBounds.begin(), arcIdBounds.end());
+
+    // balance copying by vertices plus arcs
+    for (auto t = 1U; t < numThreads; t++) {
+        size_type target = (n + m) * t / numThreads;
+        size_type lo = bounds[t - 1U], hi = n;
+        while (lo < hi) {
+            auto mid = lo + (hi - lo) / 2U;
+            if (mid + firstArc[mid] < target) {
+                lo = mid + 1U;
+            } else {
+                hi = mid;
+            }
+        }
+        bounds[t] = lo;
+    }
+
+    // object pools are not thread-safe, so allocate up front and construct in parallel
+    std::vector<IncidenceListVertex*> vertexMemory(n);
+    for (auto &p : vertexMemory) {
+        p = vertexStorage.malloc();
+    }
+    std::vector<Arc*> arcMemory(m);
+    for (auto &p : arcMemory) {
+        p = arcStorage.malloc();
+    }
+    vertices.resize(n);
+    sharedOutIndexMap.resetAll(m);
+    sharedInIndexMap.resetAll(m);
+    for (auto [map, size] : { std::make_pair(otherToThisVertices, vertexIdBound),
+                              std::make_pair(thisToOtherVertices, n),
+                              std::make_pair(otherToThisArcs, arcIdBound),
+                              std::make_pair(thisToOtherArcs, m) }) {
+        if (map != nullptr) {
+            map->resetAll(size);
+        }
+    }
+
+    forEachRange(bounds, [&](unsigned int, size_type begin, size_type end) {
+        for (auto i = begin; i < end; i++) {
+            auto *v = other.vertices[i];
+            auto *cv = new (vertexMemory[i]) IncidenceListVertex(i, sharedOutIndexMap, sharedInIndexMap, graph, i);
+            cv->setName(v->getName());
+            cv->reserveArcs(firstArc[i + 1U] - firstArc[i], v->getInDegree(true));
+            vertices[i] = cv;
+            if (otherToThisVertices != nullptr) {
+                otherToThisVertices->setValueAtId(v->getId(), cv);
+            }
+            if (thisToOtherVertices != nullptr) {
+                thisToOtherVertices->setValueAtId(i, v);
+            }
+        }
+        for (auto i = begin; i < end; i++) {
+            auto *tail = vertices[i];
+            auto k = firstArc[i];
+            other.vertices[i]->mapOutgoingArcs([&](Arc *a) {
+                auto *head = vertexMemory[static_cast<IncidenceListVertex*>(a->getHead())->getIndex()];
+                auto *ca = new (arcMemory[k]) Arc(k, graph);
+                ca->recycle(tail, head);
+                ca->setName(a->getName());
+                tail->addOutgoingArc(ca);
+                if (otherToThisArcs != nullptr) {
+                    otherToThisArcs->setValueAtId(a->getId(), ca);
+                }
+                if (thisToOtherArcs != nullptr) {
+                    thisToOtherArcs->setValueAtId(k, a);
+                }
+                k++;
+            });
+        }
+    });
+
+    // incoming lists are filled by the heads' threads, in the order of other;
+    // a copied arc sits at its original's position in the tail's list
+    forEachRange(bounds, [&](unsigned int, size_type begin, size_type end) {
+        for (auto i = begin; i < end; i++) {
+            auto *head = vertices[i];
+            other.vertices[i]->mapIncomingArcs([&](Arc *a) {
+                auto tail = static_cast<IncidenceListVertex*>(a->getTail())->getIndex();
+                head->addIncomingArc(arcMemory[firstArc[tail] + other.sharedOutIndexMap.getValueAtId(a->getId())]);
+            });
+        }
+    });
+
+    numArcs = m;
+    nextVertexId = n;
+    nextArcId = m;
+}
+
 void IncidenceListGraphImplementation::clear(bool emptyReserves)
 {
     for (IncidenceListVertex *v : vertices) {
         v->mapOutgoingArcs([this](Arc *a) {
-            a->hibernate();
-            arcPool.push_back(a);
+            poolArc(a);
         }, arcFalse, false);
         v->clearOutgoingArcs();
         v->clearIncomingArcs();
-        v->hibernate();
-        vertexPool.push_back(v);
+        poolVertex(v);
     }
     vertices.clear();
     numArcs = 0U;
@@ -141,14 +313,8 @@ void IncidenceListGraphImplementation::clear(bool emptyReserves)
     recycledArcIds.clear();
 
     if (emptyReserves) {
-        for (auto a : arcPool) {
-            arcStorage.destroy(a);
-        }
-        arcPool.clear();
-        for (auto v: vertexPool) {
-            vertexStorage.destroy(v);
-        }
-        vertexPool.clear();
+        arcStorage.destroyAll(arcPool);
+        vertexStorage.destroyAll(vertexPool);
     }
 }
 
@@ -164,8 +330,7 @@ void IncidenceListGraphImplementation::removeVertex(IncidenceListVertex *v)
         IncidenceListVertex *head = dynamic_cast<IncidenceListVertex*>(a->getHead());
         head->removeIncomingArc(a);
         //delete a;
-        a->hibernate();
-        arcPool.push_back(a);
+        poolArc(a);
         numArcs--;
     }, arcFalse, false);
     v->clearOutgoingArcs();
@@ -173,8 +338,7 @@ void IncidenceListGraphImplementation::removeVertex(IncidenceListVertex *v)
         IncidenceListVertex *tail = dynamic_cast<IncidenceListVertex*>(a->getTail());
         tail->removeOutgoingArc(a);
         //delete a;
-        a->hibernate();
-        arcPool.push_back(a);
+        poolArc(a);
         numArcs--;
     }, arcFalse, false);
     v->clearIncomingArcs();
@@ -183,13 +347,13 @@ void IncidenceListGraphImplementation::removeVertex(IncidenceListVertex *v)
     o->setIndex(index);
     vertices[index] = o;
     vertices.pop_back();
-    v->hibernate();
-    vertexPool.push_back(v);
+    poolVertex(v);
 }
 
 bool IncidenceListGraphImplementation::containsVertex(const IncidenceListVertex *v) const
 {
-    return (v->getParent() == graph && vertices.at(v->getIndex()) == v);
+    // removed vertices may have an index beyond the end
+    return (v->getParent() == graph && v->getIndex() < vertices.size() && vertices[v->getIndex()] == v);
 }
 
 IncidenceListVertex *IncidenceListGraphImplementation::getFirstVertex() const
@@ -217,8 +381,7 @@ void IncidenceListGraphImplementation::removeArc(Arc *a, IncidenceListVertex *ta
     tail->removeOutgoingArc(a);
     head->removeIncomingArc(a);
     numArcs--;
-    a->hibernate();
-    arcPool.push_back(a);
+    poolArc(a);
 }
 
 bool IncidenceListGraphImplementation::containsArc(const Arc *a, const IncidenceListVertex *tail) const
@@ -272,7 +435,7 @@ bool IncidenceListGraphImplementation::isSink(const IncidenceListVertex *v) cons
 }
 
 void IncidenceListGraphImplementation::mapVertices(const VertexMapping &vvFun,
-                                                   const VertexPredicate &breakCondition, bool checkValidity)
+                                                   const VertexPredicate &breakCondition, bool checkValidity) const
 {
     for (Vertex *v : vertices) {
         if (breakCondition(v)) {
@@ -284,7 +447,7 @@ void IncidenceListGraphImplementation::mapVertices(const VertexMapping &vvFun,
     }
 }
 
-void IncidenceListGraphImplementation::mapArcs(const ArcMapping &avFun, const ArcPredicate &breakCondition)
+void IncidenceListGraphImplementation::mapArcs(const ArcMapping &avFun, const ArcPredicate &breakCondition) const
 {
     for (IncidenceListVertex *v : vertices) {
         if (!v->mapOutgoingArcs(avFun, breakCondition)) {
@@ -294,13 +457,13 @@ void IncidenceListGraphImplementation::mapArcs(const ArcMapping &avFun, const Ar
 }
 
 void IncidenceListGraphImplementation::mapOutgoingArcs(const IncidenceListVertex *v, const ArcMapping &avFun,
-                                                         const ArcPredicate &breakCondition, bool checkValidity)
+                                                         const ArcPredicate &breakCondition, bool checkValidity) const
 {
     v->mapOutgoingArcs(avFun, breakCondition, checkValidity);
 }
 
 void IncidenceListGraphImplementation::mapIncomingArcs(const IncidenceListVertex *v, const ArcMapping &avFun,
-                                                         const ArcPredicate &breakCondition, bool checkValidity)
+                                                         const ArcPredicate &breakCondition, bool checkValidity) const
 {
     v->mapIncomingArcs(avFun, breakCondition, checkValidity);
 }
@@ -380,6 +543,137 @@ void IncidenceListGraphImplementation::reserveArcCapacity(size_type n)
     arcPool.insert(arcPool.end(), tmp.rbegin(), tmp.rend());
 }
 
+MemoryReport IncidenceListGraphImplementation::memoryUsage() const
+{
+    MemoryReport report;
+    report.add("vertex list", MemoryUsage::of(vertices));
+    report.add("vertex storage", MemoryUsage(vertices.size() * sizeof(IncidenceListVertex),
+                                             vertexStorage.getReservedBytes()));
+    // multi-arcs are allocated separately, counting them here is close enough
+    auto arcStorageBytes = arcStorage.getReservedBytes();
+    report.add("arc storage", MemoryUsage(std::min(numArcs * sizeof(Arc), arcStorageBytes),
+                                          arcStorageBytes));
+    report.add("artifact pools", MemoryUsage::of(vertexPool) + MemoryUsage::of(arcPool)
+               + MemoryUsage::of(heldVertices) + MemoryUsage::of(heldArcs)
+               + MemoryUsage::of(multiArcs));
+    report.add("recycled ids", MemoryUsage::of(recycledVertexIds) + MemoryUsage::of(recycledArcIds));
+
+    MemoryUsage lists;
+    for (const IncidenceListVertex *v : vertices) {
+        lists += v->memoryUsage();
+    }
+    // whatever pooled vertices hold is unused
+    for (const auto *pool : { &vertexPool, &heldVertices }) {
+        for (const IncidenceListVertex *v : *pool) {
+            lists.reserved += v->memoryUsage().reserved;
+        }
+    }
+    report.add("incidence lists", lists);
+    report.add("arc index maps", sharedOutIndexMap.memoryUsage() + sharedInIndexMap.memoryUsage());
+
+    return report;
+}
+
+void IncidenceListGraphImplementation::shrinkToFit()
+{
+    // clear() restarts numbering while pooled artifacts keep their ids,
+    // so live ids may exceed the next ones
+    for (const auto *list : { &vertices, &heldVertices }) {
+        for (IncidenceListVertex *v : *list) {
+            nextVertexId = std::max(nextVertexId, v->getId() + 1U);
+            mapUnbundledOutgoingArcs(v, [this](Arc *a) {
+                nextArcId = std::max(nextArcId, a->getId() + 1U);
+            });
+        }
+    }
+    for (Arc *a : heldArcs) {
+        nextArcId = std::max(nextArcId, a->getId() + 1U);
+    }
+
+    for (auto a : arcPool) {
+        recycledArcIds.push_back(a->getId());
+    }
+    arcStorage.destroyAll(arcPool);
+    for (auto v : vertexPool) {
+        recycledVertexIds.push_back(v->getId());
+    }
+    vertexStorage.destroyAll(vertexPool);
+    arcStorage.releaseMemory();
+    vertexStorage.releaseMemory();
+
+    // give back trailing ids so that id-indexed maps stay small
+    auto trimIds = [](std::vector<id_type> &ids, id_type &nextId) {
+        std::sort(ids.begin(), ids.end());
+        while (!ids.empty() && ids.back() + 1U == nextId) {
+            ids.pop_back();
+            nextId--;
+        }
+        // smallest ids are recycled first
+        std::reverse(ids.begin(), ids.end());
+        ids.shrink_to_fit();
+    };
+    trimIds(recycledVertexIds, nextVertexId);
+    trimIds(recycledArcIds, nextArcId);
+
+    for (IncidenceListVertex *v : vertices) {
+        v->fit();
+    }
+    for (IncidenceListVertex *v : heldVertices) {
+        v->fit();
+    }
+    vertices.shrink_to_fit();
+    vertexPool.shrink_to_fit();
+    arcPool.shrink_to_fit();
+    heldVertices.shrink_to_fit();
+    heldArcs.shrink_to_fit();
+    multiArcs.shrink_to_fit();
+    sharedOutIndexMap.fit();
+    sharedInIndexMap.fit();
+}
+
+void IncidenceListGraphImplementation::compact(IdMapping &vertexIds, IdMapping &arcIds)
+{
+    shrinkToFit();
+
+    vertexIds.assign(nextVertexId, NO_ID);
+    arcIds.assign(nextArcId, NO_ID);
+    id_type arcId = 0U;
+    for (IncidenceListVertex *v : vertices) {
+        vertexIds[v->getId()] = v->getIndex();
+        v->setId(v->getIndex());
+        mapUnbundledOutgoingArcs(v, [&](Arc *a) {
+            arcIds[a->getId()] = arcId;
+            a->setId(arcId);
+            arcId++;
+        });
+    }
+
+    sharedOutIndexMap.permute(arcIds);
+    sharedInIndexMap.permute(arcIds);
+    sharedOutIndexMap.fit();
+    sharedInIndexMap.fit();
+
+    nextVertexId = vertices.size();
+    nextArcId = arcId;
+    recycledVertexIds.clear();
+    recycledVertexIds.shrink_to_fit();
+    recycledArcIds.clear();
+    recycledArcIds.shrink_to_fit();
+}
+
+void IncidenceListGraphImplementation::mapUnbundledOutgoingArcs(const IncidenceListVertex *vertex,
+                                                                const ArcMapping &avFun) const
+{
+    vertex->mapOutgoingArcs([&avFun](Arc *a) {
+        auto *bundle = dynamic_cast<ParallelArcsBundle*>(a);
+        if (bundle) {
+            bundle->mapArcs(avFun);
+        } else {
+            avFun(a);
+        }
+    }, arcFalse, false);
+}
+
 IncidenceListVertex *IncidenceListGraphImplementation::recycleOrCreateIncidenceListVertex()
 {
     if (!vertexPool.empty()) {
@@ -464,6 +758,17 @@ void IncidenceListGraphImplementation::setOwner(DiGraph *handle)
     }
 }
 
+void IncidenceListGraphImplementation::holdRemovedArtifacts(bool hold)
+{
+    holdRemoved = hold;
+    if (!hold) {
+        arcPool.insert(arcPool.end(), heldArcs.begin(), heldArcs.end());
+        heldArcs.clear();
+        vertexPool.insert(vertexPool.end(), heldVertices.begin(), heldVertices.end());
+        heldVertices.clear();
+    }
+}
+
 void IncidenceListGraphImplementation::bundleOutgoingArcs(IncidenceListVertex *vertex)
 {
     std::vector<Arc*> outArcs;
@@ -29,8 +29,12 @@
 
 #include "property/modifiableproperty.h"
 #include "property/fastpropertymap.h"
+#include "graph/idmapping.h"
+#include "memoryusage.h"
 
 #include <vector>
+#include <algorithm>
+#include <functional>
 #include <boost/pool/object_pool.hpp>
 
 namespace Algora {
@@ -39,6 +43,35 @@ class IncidenceListVertex;
 
 typedef typename std::vector<IncidenceListVertex*> VertexList;
 
+// object pool that can tell and give back the memory blocks it holds
+template<typename T>
+class ArtifactStorage : public boost::object_pool<T>
+{
+public:
+    std::size_t getReservedBytes() const {
+        std::size_t bytes = 0U;
+        for (auto block = this->list; block.valid(); block = block.next()) {
+            bytes += block.total_size();
+        }
+        return bytes;
+    }
+
+    // ordered_free() walks the free list up to the freed address,
+    // so destroying in descending address order keeps this short
+    void destroyAll(std::vector<T*> &objects) {
+        std::sort(objects.begin(), objects.end(), std::greater<T*>());
+        for (T *object : objects) {
+            this->destroy(object);
+        }
+        objects.clear();
+    }
+
+    // frees all blocks without constructed objects
+    bool releaseMemory() {
+        return this->store().release_memory();
+    }
+};
+
 class IncidenceListGraphImplementation {
 
 public:
@@ -65,6 +98,13 @@ public:
                                              ModifiableProperty<GraphArtifact*> *thisToOtherArcs = nullptr
             );
     IncidenceListGraphImplementation& operator=(const IncidenceListGraphImplementation &other) { return assign(other); }
+    // allocates all artifacts up front, then copies vertex ranges in parallel;
+    // mappings are indexed by id
+    void assignParallel(const IncidenceListGraphImplementation &other, unsigned int numThreads,
+                        FastPropertyMap<GraphArtifact*> *otherToThisVertices = nullptr,
+                        FastPropertyMap<GraphArtifact*> *otherToThisArcs = nullptr,
+                        FastPropertyMap<GraphArtifact*> *thisToOtherVertices = nullptr,
+                        FastPropertyMap<GraphArtifact*> *thisToOtherArcs = nullptr);
 
     // moving is costly, but better than copying
     IncidenceListGraphImplementation(IncidenceListGraphImplementation &&other) = default;
@@ -91,13 +131,13 @@ public:
     bool isSource(const IncidenceListVertex *v) const;
     bool isSink(const IncidenceListVertex *v) const;
 
-    void mapVertices(const VertexMapping &vvFun, const VertexPredicate &breakCondition, bool checkValidity = true);
+    void mapVertices(const VertexMapping &vvFun, const VertexPredicate &breakCondition, bool checkValidity = true) const;
 
-    void mapArcs(const ArcMapping &avFun, const ArcPredicate &breakCondition);
+    void mapArcs(const ArcMapping &avFun, const ArcPredicate &breakCondition) const;
     void mapOutgoingArcs(const IncidenceListVertex *v, const ArcMapping &avFun,
-                         const ArcPredicate &breakCondition, bool checkValidity = true);
+                         const ArcPredicate &breakCondition, bool checkValidity = true) const;
     void mapIncomingArcs(const IncidenceListVertex *v, const ArcMapping &avFun,
-                         const ArcPredicate &breakCondition, bool checkValidity = true);
+                         const ArcPredicate &breakCondition, bool checkValidity = true) const;
 
     bool isEmpty() const;
     Graph::size_type getSize() const;
@@ -107,6 +147,14 @@ public:
     void reserveVertexCapacity(size_type n);
     void reserveArcCapacity(size_type n);
 
+    MemoryReport memoryUsage() const;
+    // destroys pooled (but not held) vertices and arcs, returns free storage
+    // blocks and shrinks all lists; ids of destroyed artifacts are recycled
+    void shrinkToFit();
+    // releases pools and numbers vertices and arcs densely, vertex ids then
+    // equal indices; fills the old-to-new id mappings
+    void compact(IdMapping &vertexIds, IdMapping &arcIds);
+
     IncidenceListVertex *recycleOrCreateIncidenceListVertex();
     IncidenceListVertex *createIncidenceListVertex();
     Arc *recycleOrCreateArc(IncidenceListVertex *tail, IncidenceListVertex *head);
@@ -116,6 +164,10 @@ public:
     id_type getNextArcId();
     void setOwner(DiGraph *handle);
 
+    // keep removed vertices and arcs from being recycled, e.g., while their removal
+    // has not been announced yet; releasing moves them to the pools
+    void holdRemovedArtifacts(bool hold);
+
 private:
     DiGraph *graph;
     VertexList vertices;
@@ -125,16 +177,38 @@ private:
     std::vector<id_type> recycledVertexIds;
     std::vector<id_type> recycledArcIds;
 
-    boost::object_pool<IncidenceListVertex> vertexStorage;
-    boost::object_pool<Arc> arcStorage;
+    ArtifactStorage<IncidenceListVertex> vertexStorage;
+    ArtifactStorage<Arc> arcStorage;
     std::vector<IncidenceListVertex*> vertexPool;
     std::vector<Arc*> arcPool;
     std::vector<MultiArc*> multiArcs;
+    bool holdRemoved;
+    std::vector<IncidenceListVertex*> heldVertices;
+    std::vector<Arc*> heldArcs;
 
     FastPropertyMap<size_type> sharedOutIndexMap;
     FastPropertyMap<size_type> sharedInIndexMap;
 
+    void poolVertex(IncidenceListVertex *v) {
+        v->hibernate();
+        if (holdRemoved) {
+            heldVertices.push_back(v);
+        } else {
+            vertexPool.push_back(v);
+        }
+    }
+    void poolArc(Arc *a) {
+        a->hibernate();
+        if (holdRemoved) {
+            heldArcs.push_back(a);
+        } else {
+            arcPool.push_back(a);
+        }
+    }
+
     void bundleOutgoingArcs(IncidenceListVertex *vertex);
+    // all outgoing arcs of vertex, bundles are resolved to the arcs they contain
+    void mapUnbundledOutgoingArcs(const IncidenceListVertex *vertex, const ArcMapping &avFun) const;
     void unbundleOutgoingArcs(IncidenceListVertex *vertex);
 
     void copyFrom(const IncidenceListGraphImplementation &other,
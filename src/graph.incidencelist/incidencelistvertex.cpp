@@ -237,6 +237,17 @@ void IncidenceListVertex::enableConsistencyCheck(bool enable)
     grin->checkConsisteny = enable;
 }
 
+void IncidenceListVertex::reserveArcs(size_type outgoing, size_type incoming)
+{
+    grin->outgoingArcs.reserve(outgoing);
+    grin->incomingArcs.reserve(incoming);
+}
+
+bool IncidenceListVertex::hasMultiArcs() const
+{
+    return !grin->outgoingMultiArcs.empty() || !grin->incomingMultiArcs.empty();
+}
+
 IncidenceListVertex::size_type IncidenceListVertex::getIndex() const
 {
     return grin->index;
@@ -258,6 +269,30 @@ void IncidenceListVertex::recycle()
     revalidate();
 }
 
+MemoryUsage IncidenceListVertex::memoryUsage() const
+{
+    MemoryUsage usage(sizeof(CheshireCat), sizeof(CheshireCat));
+    usage += MemoryUsage::of(grin->outgoingArcs);
+    usage += MemoryUsage::of(grin->incomingArcs);
+    usage += MemoryUsage::of(grin->outgoingMultiArcs);
+    usage += MemoryUsage::of(grin->incomingMultiArcs);
+    usage += grin->bundle.memoryUsage();
+    usage += grin->multiOutIndex.memoryUsage();
+    usage += grin->multiInIndex.memoryUsage();
+    return usage;
+}
+
+void IncidenceListVertex::fit()
+{
+    grin->outgoingArcs.shrink_to_fit();
+    grin->incomingArcs.shrink_to_fit();
+    grin->outgoingMultiArcs.shrink_to_fit();
+    grin->incomingMultiArcs.shrink_to_fit();
+    grin->bundle.fit();
+    grin->multiOutIndex.fit();
+    grin->multiInIndex.fit();
+}
+
 bool IncidenceListVertex::hasOutgoingArc(const Arc *a) const
 {
     return isArcInList(grin->outIndex, grin->outgoingArcs, a)
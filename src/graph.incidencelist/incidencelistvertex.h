@@ -25,6 +25,7 @@
 
 #include "graph/vertex.h"
 #include "graph/graph_functional.h"
+#include "memoryusage.h"
 
 namespace Algora {
 
@@ -75,6 +76,9 @@ public:
 
     size_type getIndex() const;
 
+    // incidence lists and their index maps, the shared arc index maps excluded
+    MemoryUsage memoryUsage() const;
+
 protected:
     virtual void addOutgoingArc(Arc *a);
     virtual void removeOutgoingArc(const Arc *a);
@@ -85,11 +89,14 @@ protected:
     virtual void clearIncomingArcs();
 
     virtual void enableConsistencyCheck(bool enable);
+    void reserveArcs(size_type outgoing, size_type incoming);
+    bool hasMultiArcs() const;
 
     void setIndex(size_type i);
 
     void hibernate();
     void recycle();
+    void fit();
 
 private:
     class CheshireCat;
@@ -0,0 +1,150 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "inducedsubgraph.h"
+
+#include "graph/vertex.h"
+#include "graph/arc.h"
+#include "graph/multiarc.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+namespace Algora {
+
+typedef DiGraph::size_type size_type;
+
+// don't bother spawning threads for less work than that
+static const size_type MIN_VERTICES_PER_THREAD = 4096U;
+
+IncidenceListGraph *extractInducedSubgraph(DiGraph *graph, const std::vector<Vertex*> &vertexSet,
+                                           FastPropertyMap<Vertex*> *oldToNewVertices,
+                                           FastPropertyMap<Vertex*> *newToOldVertices,
+                                           FastPropertyMap<Arc*> *oldToNewArcs,
+                                           FastPropertyMap<Arc*> *newToOldArcs,
+                                           unsigned int numThreads)
+{
+    // new index + 1, 0 means not selected
+    FastPropertyMap<size_type> newIndex(0U);
+    std::vector<Vertex*> selected;
+    selected.reserve(vertexSet.size());
+    for (Vertex *v : vertexSet) {
+        if (!graph->containsVertex(v)) {
+            throw std::invalid_argument("Vertex is not a part of this graph.");
+        }
+        if (newIndex.getValueAtId(v->getId()) == 0U) {
+            selected.push_back(v);
+            newIndex.setValueAtId(v->getId(), selected.size());
+        }
+    }
+
+    // collect the arcs to copy; newIndex is read-only from here on
+    std::vector<std::vector<Arc*>> outArcs(selected.size());
+    // only IncidenceListGraph guarantees that concurrent reads are safe
+    const IncidenceListGraph *incidenceListGraph = dynamic_cast<const IncidenceListGraph*>(graph);
+    auto collect = [&](size_type begin, size_type end) {
+        for (auto i = begin; i < end; i++) {
+            auto keep = [&](Arc *a) {
+                if (newIndex.getValueAtId(a->getHead()->getId()) > 0U) {
+                    outArcs[i].push_back(a);
+                }
+            };
+            if (incidenceListGraph) {
+                incidenceListGraph->mapOutgoingArcs(selected[i], keep);
+            } else {
+                graph->mapOutgoingArcs(selected[i], keep);
+            }
+        }
+    };
+
+    if (incidenceListGraph == nullptr) {
+        numThreads = 1U;
+    } else if (numThreads == 0U) {
+        numThreads = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    size_type maxThreads = selected.size() / MIN_VERTICES_PER_THREAD + 1U;
+    if (numThreads > maxThreads) {
+        numThreads = maxThreads;
+    }
+    if (numThreads <= 1U) {
+        collect(0U, selected.size());
+    } else {
+        std::vector<std::thread> threads;
+        threads.reserve(numThreads);
+        size_type chunk = selected.size() / numThreads;
+        size_type rest = selected.size() % numThreads;
+        size_type begin = 0U;
+        for (auto t = 0U; t < numThreads; t++) {
+            size_type end = begin + chunk + (t < rest ? 1U : 0U);
+            threads.emplace_back(collect, begin, end);
+            begin = end;
+        }
+        for (std::thread &t : threads) {
+            t.join();
+        }
+    }
+
+    IncidenceListGraph *subgraph = new IncidenceListGraph(graph->getParent());
+    size_type numArcs = 0U;
+    for (const auto &arcs : outArcs) {
+        numArcs += arcs.size();
+    }
+    subgraph->reserveVertexCapacity(selected.size());
+    subgraph->reserveArcCapacity(numArcs);
+
+    std::vector<Vertex*> newVertices;
+    newVertices.reserve(selected.size());
+    for (Vertex *v : selected) {
+        Vertex *nv = subgraph->addVertex();
+        newVertices.push_back(nv);
+        if (oldToNewVertices) {
+            oldToNewVertices->setValue(v, nv);
+        }
+        if (newToOldVertices) {
+            newToOldVertices->setValue(nv, v);
+        }
+    }
+
+    for (size_type i = 0U; i < selected.size(); i++) {
+        Vertex *tail = newVertices[i];
+        for (Arc *a : outArcs[i]) {
+            Vertex *head = newVertices[newIndex.getValueAtId(a->getHead()->getId()) - 1U];
+            Arc *na;
+            if (dynamic_cast<MultiArc*>(a)) {
+                na = subgraph->addMultiArc(tail, head, a->getSize());
+            } else {
+                na = subgraph->addArc(tail, head);
+            }
+            if (oldToNewArcs) {
+                oldToNewArcs->setValue(a, na);
+            }
+            if (newToOldArcs) {
+                newToOldArcs->setValue(na, a);
+            }
+        }
+    }
+
+    return subgraph;
+}
+
+}
@@ -0,0 +1,51 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef INDUCEDSUBGRAPH_H
+#define INDUCEDSUBGRAPH_H
+
+#include "incidencelistgraph.h"
+#include "property/fastpropertymap.h"
+
+#include <vector>
+
+namespace Algora {
+
+// Copies the subgraph of graph induced by vertexSet into a new graph whose
+// vertices and arcs are numbered consecutively, in the order given by
+// vertexSet and, per vertex, by its outgoing arcs.
+// Vertices listed more than once are copied only once.
+// The optional maps translate between original and copied artifacts.
+// If graph is an IncidenceListGraph, the scan of it is split among numThreads
+// threads (0: one per hardware thread), so graph must not be modified
+// meanwhile. Other graphs are scanned sequentially.
+// The caller takes ownership of the returned graph.
+IncidenceListGraph *extractInducedSubgraph(DiGraph *graph, const std::vector<Vertex*> &vertexSet,
+                                           FastPropertyMap<Vertex*> *oldToNewVertices = nullptr,
+                                           FastPropertyMap<Vertex*> *newToOldVertices = nullptr,
+                                           FastPropertyMap<Arc*> *oldToNewArcs = nullptr,
+                                           FastPropertyMap<Arc*> *newToOldArcs = nullptr,
+                                           unsigned int numThreads = 0U);
+
+}
+
+#endif // INDUCEDSUBGRAPH_H
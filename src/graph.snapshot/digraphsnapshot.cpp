@@ -0,0 +1,70 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "digraphsnapshot.h"
+
+#include <algorithm>
+
+namespace Algora {
+
+MemoryUsage DiGraphSnapshot::Block::memoryUsage() const
+{
+    MemoryUsage usage(sizeof(Block), sizeof(Block));
+    usage += MemoryUsage::of(present);
+    usage += MemoryUsage::of(outOffsets);
+    usage += MemoryUsage::of(outHeads);
+    usage += MemoryUsage::of(outArcIds);
+    usage += MemoryUsage::of(inOffsets);
+    usage += MemoryUsage::of(inTails);
+    usage += MemoryUsage::of(inArcIds);
+    return usage;
+}
+
+MemoryUsage DiGraphSnapshot::memoryUsage(const DiGraphSnapshot *previous) const
+{
+    MemoryUsage usage(sizeof(DiGraphSnapshot), sizeof(DiGraphSnapshot));
+    usage += MemoryUsage::of(blocks);
+    for (auto i = 0ULL; i < blocks.size(); i++) {
+        if (!blocks[i]) {
+            continue;
+        }
+        if (previous != nullptr && i < previous->blocks.size() && previous->blocks[i] == blocks[i]) {
+            continue;
+        }
+        usage += blocks[i]->memoryUsage();
+    }
+    return usage;
+}
+
+DiGraphSnapshot::size_type DiGraphSnapshot::getNumSharedBlocks(const DiGraphSnapshot &other) const
+{
+    size_type shared = 0U;
+    auto n = std::min(blocks.size(), other.blocks.size());
+    for (auto i = 0ULL; i < n; i++) {
+        if (blocks[i] && blocks[i] == other.blocks[i]) {
+            shared++;
+        }
+    }
+    return shared;
+}
+
+}
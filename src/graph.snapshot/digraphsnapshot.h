@@ -0,0 +1,146 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef DIGRAPHSNAPSHOT_H
+#define DIGRAPHSNAPSHOT_H
+
+#include "graph/graphartifact.h"
+#include "memoryusage.h"
+
+#include <vector>
+#include <memory>
+
+namespace Algora {
+
+// Immutable copy of a digraph's structure in terms of vertex and arc ids,
+// created by a DiGraphSnapshotPublisher. Vertices are grouped into blocks of
+// BLOCK_SIZE consecutive ids, each stored as compressed sparse rows; blocks
+// without changes are shared between consecutive snapshots.
+// All methods are const and may be called from any number of threads.
+class DiGraphSnapshot
+{
+    friend class DiGraphSnapshotPublisher;
+
+public:
+    typedef GraphArtifact::id_type id_type;
+    typedef GraphArtifact::size_type size_type;
+    static constexpr size_type BLOCK_SIZE = 256U;
+
+    struct Block {
+        size_type numVertices = 0U;
+        std::vector<char> present;
+        // arcs of the vertex with id (block start + i) are at offsets[i]..offsets[i+1]
+        std::vector<size_type> outOffsets;
+        std::vector<id_type> outHeads;
+        std::vector<id_type> outArcIds;
+        std::vector<size_type> inOffsets;
+        std::vector<id_type> inTails;
+        std::vector<id_type> inArcIds;
+
+        MemoryUsage memoryUsage() const;
+    };
+
+    unsigned long long getVersion() const { return version; }
+    bool hasIncomingArcs() const { return withIncoming; }
+
+    size_type getSize() const { return numVertices; }
+    size_type getNumArcs() const { return numArcs; }
+    // all vertex ids are smaller
+    id_type getIdBound() const { return blocks.size() * BLOCK_SIZE; }
+
+    bool containsVertex(id_type v) const {
+        const Block *b = blockOf(v);
+        return b != nullptr && b->present[v % BLOCK_SIZE];
+    }
+
+    // fun(vertexId)
+    template<typename VertexIdFunction>
+    void mapVertices(const VertexIdFunction &fun) const {
+        for (auto i = 0ULL; i < blocks.size(); i++) {
+            if (!blocks[i]) {
+                continue;
+            }
+            for (auto j = 0ULL; j < BLOCK_SIZE; j++) {
+                if (blocks[i]->present[j]) {
+                    fun(i * BLOCK_SIZE + j);
+                }
+            }
+        }
+    }
+
+    size_type getOutDegree(id_type v) const {
+        const Block *b = blockOf(v);
+        return b == nullptr ? 0U : b->outOffsets[v % BLOCK_SIZE + 1U] - b->outOffsets[v % BLOCK_SIZE];
+    }
+
+    // only if hasIncomingArcs()
+    size_type getInDegree(id_type v) const {
+        const Block *b = blockOf(v);
+        return b == nullptr ? 0U : b->inOffsets[v % BLOCK_SIZE + 1U] - b->inOffsets[v % BLOCK_SIZE];
+    }
+
+    // fun(headId, arcId)
+    template<typename ArcIdFunction>
+    void mapOutgoingArcs(id_type v, const ArcIdFunction &fun) const {
+        const Block *b = blockOf(v);
+        if (b == nullptr) {
+            return;
+        }
+        auto i = v % BLOCK_SIZE;
+        for (auto k = b->outOffsets[i]; k < b->outOffsets[i + 1U]; k++) {
+            fun(b->outHeads[k], b->outArcIds[k]);
+        }
+    }
+
+    // fun(tailId, arcId); only if hasIncomingArcs()
+    template<typename ArcIdFunction>
+    void mapIncomingArcs(id_type v, const ArcIdFunction &fun) const {
+        const Block *b = blockOf(v);
+        if (b == nullptr || !withIncoming) {
+            return;
+        }
+        auto i = v % BLOCK_SIZE;
+        for (auto k = b->inOffsets[i]; k < b->inOffsets[i + 1U]; k++) {
+            fun(b->inTails[k], b->inArcIds[k]);
+        }
+    }
+
+    // memory of all blocks, or only of those not shared with previous
+    MemoryUsage memoryUsage(const DiGraphSnapshot *previous = nullptr) const;
+    size_type getNumSharedBlocks(const DiGraphSnapshot &other) const;
+
+private:
+    unsigned long long version = 0ULL;
+    bool withIncoming = false;
+    size_type numVertices = 0U;
+    size_type numArcs = 0U;
+    std::vector<std::shared_ptr<const Block>> blocks;
+
+    const Block *blockOf(id_type v) const {
+        auto i = v / BLOCK_SIZE;
+        return i < blocks.size() ? blocks[i].get() : nullptr;
+    }
+};
+
+}
+
+#endif // DIGRAPHSNAPSHOT_H
@@ -0,0 +1,195 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "digraphsnapshotpublisher.h"
+
+#include "graph/digraph.h"
+#include "graph/vertex.h"
+#include "graph/arc.h"
+#include "graph.incidencelist/incidencelistgraph.h"
+
+#include <atomic>
+#include <algorithm>
+
+namespace Algora {
+
+DiGraphSnapshotPublisher::DiGraphSnapshotPublisher(DiGraph &graph, bool withIncomingArcs)
+    : graph(graph), withIncoming(withIncomingArcs), version(0ULL),
+      current(std::make_shared<const DiGraphSnapshot>())
+{
+    graph.onVertexAdd(this, [this](Vertex *v) { addVertex(v); });
+    graph.onVertexRemove(this, [this](Vertex *v) { removeVertex(v); });
+    graph.onArcAdd(this, [this](Arc *a) { changeArc(a); });
+    graph.onArcRemove(this, [this](Arc *a) { changeArc(a); });
+    auto *ilg = dynamic_cast<IncidenceListGraph*>(&graph);
+    if (ilg != nullptr) {
+        ilg->onCompaction(this, [this](const IdMapping &, const IdMapping &) { invalidateAll(); });
+    }
+    invalidateAll();
+}
+
+DiGraphSnapshotPublisher::~DiGraphSnapshotPublisher()
+{
+    graph.removeOnVertexAdd(this);
+    graph.removeOnVertexRemove(this);
+    graph.removeOnArcAdd(this);
+    graph.removeOnArcRemove(this);
+    auto *ilg = dynamic_cast<IncidenceListGraph*>(&graph);
+    if (ilg != nullptr) {
+        ilg->removeOnCompaction(this);
+    }
+}
+
+std::shared_ptr<const DiGraphSnapshot> DiGraphSnapshotPublisher::publish()
+{
+    auto previous = std::atomic_load(&current);
+    auto snapshot = std::make_shared<DiGraphSnapshot>();
+    snapshot->version = ++version;
+    snapshot->withIncoming = withIncoming;
+    snapshot->blocks = previous->blocks;
+    snapshot->blocks.resize((verticesById.size() + DiGraphSnapshot::BLOCK_SIZE - 1U)
+                            / DiGraphSnapshot::BLOCK_SIZE);
+    for (auto b : dirtyBlocks) {
+        snapshot->blocks[b] = buildBlock(b);
+        dirty[b] = false;
+    }
+    dirtyBlocks.clear();
+
+    for (const auto &block : snapshot->blocks) {
+        if (block) {
+            snapshot->numVertices += block->numVertices;
+            snapshot->numArcs += block->outHeads.size();
+        }
+    }
+
+    std::shared_ptr<const DiGraphSnapshot> published(std::move(snapshot));
+    std::atomic_store(&current, published);
+    return published;
+}
+
+std::shared_ptr<const DiGraphSnapshot> DiGraphSnapshotPublisher::getSnapshot() const
+{
+    return std::atomic_load(&current);
+}
+
+void DiGraphSnapshotPublisher::invalidateAll()
+{
+    verticesById.clear();
+    graph.mapVertices([this](Vertex *v) {
+        if (v->getId() >= verticesById.size()) {
+            verticesById.resize(v->getId() + 1U, nullptr);
+        }
+        verticesById[v->getId()] = v;
+    });
+    // blocks beyond the current ids must be emptied, too
+    auto numBlocks = std::max(getSnapshot()->blocks.size(),
+                              (verticesById.size() + DiGraphSnapshot::BLOCK_SIZE - 1U)
+                              / DiGraphSnapshot::BLOCK_SIZE);
+    if (verticesById.size() < numBlocks * DiGraphSnapshot::BLOCK_SIZE) {
+        verticesById.resize(numBlocks * DiGraphSnapshot::BLOCK_SIZE, nullptr);
+    }
+    dirty.assign(numBlocks, true);
+    dirtyBlocks.clear();
+    for (auto b = 0ULL; b < numBlocks; b++) {
+        dirtyBlocks.push_back(b);
+    }
+}
+
+void DiGraphSnapshotPublisher::markDirty(id_type v)
+{
+    auto b = v / DiGraphSnapshot::BLOCK_SIZE;
+    if (b >= dirty.size()) {
+        dirty.resize(b + 1U, false);
+    }
+    if (!dirty[b]) {
+        dirty[b] = true;
+        dirtyBlocks.push_back(b);
+    }
+}
+
+void DiGraphSnapshotPublisher::addVertex(Vertex *v)
+{
+    if (v->getId() >= verticesById.size()) {
+        verticesById.resize(v->getId() + 1U, nullptr);
+    }
+    verticesById[v->getId()] = v;
+    markDirty(v->getId());
+}
+
+void DiGraphSnapshotPublisher::removeVertex(Vertex *v)
+{
+    verticesById[v->getId()] = nullptr;
+    markDirty(v->getId());
+}
+
+void DiGraphSnapshotPublisher::changeArc(Arc *a)
+{
+    markDirty(a->getTail()->getId());
+    if (withIncoming) {
+        markDirty(a->getHead()->getId());
+    }
+}
+
+std::shared_ptr<const DiGraphSnapshot::Block> DiGraphSnapshotPublisher::buildBlock(size_type block) const
+{
+    auto first = block * DiGraphSnapshot::BLOCK_SIZE;
+    auto last = std::min(first + DiGraphSnapshot::BLOCK_SIZE, verticesById.size());
+    auto b = std::make_shared<DiGraphSnapshot::Block>();
+    b->present.assign(DiGraphSnapshot::BLOCK_SIZE, false);
+    b->outOffsets.reserve(DiGraphSnapshot::BLOCK_SIZE + 1U);
+    b->outOffsets.push_back(0U);
+    if (withIncoming) {
+        b->inOffsets.reserve(DiGraphSnapshot::BLOCK_SIZE + 1U);
+        b->inOffsets.push_back(0U);
+    }
+    for (auto id = first; id < first + DiGraphSnapshot::BLOCK_SIZE; id++) {
+        Vertex *v = id < last ? verticesById[id] : nullptr;
+        if (v != nullptr) {
+            b->present[id - first] = true;
+            b->numVertices++;
+            graph.mapOutgoingArcs(v, [&b](Arc *a) {
+                b->outHeads.push_back(a->getHead()->getId());
+                b->outArcIds.push_back(a->getId());
+            });
+            if (withIncoming) {
+                graph.mapIncomingArcs(v, [&b](Arc *a) {
+                    b->inTails.push_back(a->getTail()->getId());
+                    b->inArcIds.push_back(a->getId());
+                });
+            }
+        }
+        b->outOffsets.push_back(b->outHeads.size());
+        if (withIncoming) {
+            b->inOffsets.push_back(b->inTails.size());
+        }
+    }
+    if (b->numVertices == 0U) {
+        return nullptr;
+    }
+    b->outHeads.shrink_to_fit();
+    b->outArcIds.shrink_to_fit();
+    b->inTails.shrink_to_fit();
+    b->inArcIds.shrink_to_fit();
+    return b;
+}
+
+}
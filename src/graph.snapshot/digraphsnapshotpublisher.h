@@ -0,0 +1,81 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef DIGRAPHSNAPSHOTPUBLISHER_H
+#define DIGRAPHSNAPSHOTPUBLISHER_H
+
+#include "digraphsnapshot.h"
+
+#include <memory>
+#include <vector>
+
+namespace Algora {
+
+class DiGraph;
+class Vertex;
+class Arc;
+
+// Publishes DiGraphSnapshots of a graph that is modified by a single writer.
+// The publisher observes the graph and rebuilds only blocks with changes.
+// publish() and invalidateAll() must be called by the writer, outside of
+// transactions; getSnapshot() may be called by any thread, readers then
+// traverse their snapshot without any synchronization.
+// Changes that are not announced to observers (clearAndRelease()) require
+// invalidateAll(); compacting an IncidenceListGraph is handled.
+// The graph must outlive the publisher.
+class DiGraphSnapshotPublisher
+{
+public:
+    typedef DiGraphSnapshot::id_type id_type;
+    typedef DiGraphSnapshot::size_type size_type;
+
+    explicit DiGraphSnapshotPublisher(DiGraph &graph, bool withIncomingArcs = false);
+    ~DiGraphSnapshotPublisher();
+
+    DiGraphSnapshotPublisher(const DiGraphSnapshotPublisher &other) = delete;
+    DiGraphSnapshotPublisher &operator=(const DiGraphSnapshotPublisher &other) = delete;
+
+    std::shared_ptr<const DiGraphSnapshot> publish();
+    std::shared_ptr<const DiGraphSnapshot> getSnapshot() const;
+
+    size_type getNumDirtyBlocks() const { return dirtyBlocks.size(); }
+    void invalidateAll();
+
+private:
+    DiGraph &graph;
+    bool withIncoming;
+    unsigned long long version;
+    std::vector<Vertex*> verticesById;
+    std::vector<char> dirty;
+    std::vector<size_type> dirtyBlocks;
+    std::shared_ptr<const DiGraphSnapshot> current;
+
+    void markDirty(id_type v);
+    void addVertex(Vertex *v);
+    void removeVertex(Vertex *v);
+    void changeArc(Arc *a);
+    std::shared_ptr<const DiGraphSnapshot::Block> buildBlock(size_type block) const;
+};
+
+}
+
+#endif // DIGRAPHSNAPSHOTPUBLISHER_H
@@ -0,0 +1,218 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "arcreversingview.h"
+
+#include "vertex.h"
+#include "graph.incidencelist/incidencelistgraph.h"
+
+#include <stdexcept>
+
+namespace Algora {
+
+ArcReversingView::ArcReversingView(DiGraph *graph)
+    : superGraph(graph), compactingGraph(dynamic_cast<IncidenceListGraph*>(graph)),
+      reverseArcs(nullptr)
+{
+    if (compactingGraph) {
+        compactingGraph->onCompaction(this, [this](const IdMapping &, const IdMapping &) {
+            releaseReverseArcs();
+        });
+    }
+    graph->onVertexAdd(this, [this](Vertex *v) { greetVertex(v); });
+    graph->onVertexRemove(this, [this](Vertex *v) { dismissVertex(v); });
+    graph->onArcAdd(this, [this](Arc *a) { forwardArcGreeting(a); });
+    graph->onArcRemove(this, [this](Arc *a) {
+        forwardArcFarewell(a);
+        releaseReverseArc(a);
+    });
+
+    // forward batches as batches
+    graph->onVerticesAdd(this, [this](const std::vector<Vertex*> &vertices) {
+        beginTransaction();
+        for (Vertex *v : vertices) {
+            greetVertex(v);
+        }
+        commitTransaction();
+    });
+    graph->onVerticesRemove(this, [this](const std::vector<Vertex*> &vertices) {
+        beginTransaction();
+        for (Vertex *v : vertices) {
+            dismissVertex(v);
+        }
+        commitTransaction();
+    });
+    graph->onArcsAdd(this, [this](const std::vector<Arc*> &arcs) {
+        beginTransaction();
+        for (Arc *a : arcs) {
+            forwardArcGreeting(a);
+        }
+        commitTransaction();
+    });
+    graph->onArcsRemove(this, [this](const std::vector<Arc*> &arcs) {
+        beginTransaction();
+        for (Arc *a : arcs) {
+            forwardArcFarewell(a);
+        }
+        commitTransaction();
+        for (Arc *a : arcs) {
+            releaseReverseArc(a);
+        }
+    });
+}
+
+ArcReversingView::~ArcReversingView()
+{
+    superGraph->removeOnVertexAdd(this);
+    superGraph->removeOnVertexRemove(this);
+    superGraph->removeOnArcAdd(this);
+    superGraph->removeOnArcRemove(this);
+    superGraph->removeOnVerticesAdd(this);
+    superGraph->removeOnVerticesRemove(this);
+    superGraph->removeOnArcsAdd(this);
+    superGraph->removeOnArcsRemove(this);
+    if (compactingGraph) {
+        compactingGraph->removeOnCompaction(this);
+    }
+
+    for (ReverseArc *r : reverseArcs) {
+        delete r;
+    }
+    deleteRetiredArcs();
+}
+
+Arc *ArcReversingView::getOriginalArc(const Arc *a) const
+{
+    if (isReverseArc(a)) {
+        return static_cast<const ReverseArc*>(a)->getReversedArc();
+    }
+    return const_cast<Arc*>(a);
+}
+
+void ArcReversingView::releaseReverseArcs()
+{
+    for (ReverseArc *r : reverseArcs) {
+        if (r) {
+            retiredArcs.push_back(r);
+        }
+    }
+    reverseArcs.resetAll(0U);
+    // observers may not have been notified yet
+    if (!isInTransaction()) {
+        deleteRetiredArcs();
+    }
+}
+
+Vertex *ArcReversingView::addVertex()
+{
+    return superGraph->addVertex();
+}
+
+void ArcReversingView::removeVertex(Vertex *v)
+{
+    superGraph->removeVertex(v);
+}
+
+bool ArcReversingView::containsVertex(const Vertex *v) const
+{
+    return superGraph->containsVertex(v);
+}
+
+Vertex *ArcReversingView::getAnyVertex() const
+{
+    return superGraph->getAnyVertex();
+}
+
+void ArcReversingView::mapVerticesUntil(const VertexMapping &vvFun, const VertexPredicate &breakCondition)
+{
+    superGraph->mapVerticesUntil(vvFun, breakCondition);
+}
+
+bool ArcReversingView::isEmpty() const
+{
+    return superGraph->isEmpty();
+}
+
+Graph::size_type ArcReversingView::getSize() const
+{
+    return superGraph->getSize();
+}
+
+void ArcReversingView::removeArc(Arc *a)
+{
+    if (!containsArc(a)) {
+        throw std::invalid_argument("Arc is not a part of this graph.");
+    }
+    superGraph->removeArc(getOriginalArc(a));
+}
+
+void ArcReversingView::commitTransaction()
+{
+    try {
+        DiGraph::commitTransaction();
+    } catch (...) {
+        if (!isInTransaction()) {
+            deleteRetiredArcs();
+        }
+        throw;
+    }
+    if (!isInTransaction()) {
+        deleteRetiredArcs();
+    }
+}
+
+ReverseArc *ArcReversingView::reverse(const Arc *a) const
+{
+    auto id = a->getId();
+    ReverseArc *r = reverseArcs.getValueAtId(id);
+    if (!r) {
+        r = new ReverseArc(const_cast<Arc*>(a), const_cast<ArcReversingView*>(this));
+        reverseArcs.setValueAtId(id, r);
+    }
+    return r;
+}
+
+void ArcReversingView::releaseReverseArc(const Arc *a)
+{
+    auto id = a->getId();
+    ReverseArc *r = reverseArcs.getValueAtId(id);
+    if (!r) {
+        return;
+    }
+    reverseArcs.resetAtId(id);
+    // observers may not have been notified yet
+    if (isInTransaction()) {
+        retiredArcs.push_back(r);
+    } else {
+        delete r;
+    }
+}
+
+void ArcReversingView::deleteRetiredArcs()
+{
+    for (ReverseArc *r : retiredArcs) {
+        delete r;
+    }
+    retiredArcs.clear();
+}
+
+}
@@ -0,0 +1,114 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef ARCREVERSINGVIEW_H
+#define ARCREVERSINGVIEW_H
+
+#include "digraph.h"
+#include "reversearc.h"
+#include "property/fastpropertymap.h"
+
+#include <vector>
+
+namespace Algora {
+
+class IncidenceListGraph;
+
+// Common base of views that present (some) arcs of another graph in
+// reverse direction. The wrapped graph is not copied, but reversed arcs are
+// objects of their own: each is a ReverseArc that is created on first use
+// and shares the id of the original arc, so that FastPropertyMaps can be
+// used across graph and view.
+// Vertices are those of the wrapped graph. Multiarcs are reversed to arcs of
+// the same size.
+// Reversed arcs are kept until their original arc is removed, the view is
+// destroyed or releaseReverseArcs() is called, so after a full traversal
+// the view holds one ReverseArc (~90 bytes) per reversed arc plus a pointer
+// per arc id, i.e., memory linear in the number of arcs.
+// If the wrapped graph is an IncidenceListGraph, compacting it releases all
+// reversed arcs, since their ids are stale afterwards.
+// Since even const queries may create reversed arcs, a view must not be
+// read from several threads at once.
+class ArcReversingView : public DiGraph
+{
+public:
+    explicit ArcReversingView(DiGraph *graph);
+    virtual ~ArcReversingView() override;
+
+    ArcReversingView(const ArcReversingView &other) = delete;
+    ArcReversingView &operator=(const ArcReversingView &other) = delete;
+
+    DiGraph *getSuperGraph() const { return superGraph; }
+    // the arc of the wrapped graph that a stands for
+    Arc *getOriginalArc(const Arc *a) const;
+    // Frees all reversed arcs created so far; arcs obtained from the view
+    // before are invalid afterwards.
+    void releaseReverseArcs();
+
+    // Graph interface
+public:
+    virtual Vertex *addVertex() override;
+    virtual void removeVertex(Vertex *v) override;
+    virtual bool containsVertex(const Vertex *v) const override;
+    virtual Vertex *getAnyVertex() const override;
+    virtual void mapVerticesUntil(const VertexMapping &vvFun, const VertexPredicate &breakCondition) override;
+    virtual bool isEmpty() const override;
+    virtual size_type getSize() const override;
+
+    // DiGraph interface
+public:
+    virtual void removeArc(Arc *a) override;
+    virtual void commitTransaction() override;
+
+protected:
+    DiGraph *superGraph;
+    // superGraph, if it can be compacted
+    IncidenceListGraph *compactingGraph;
+
+    bool isReverseArc(const Arc *a) const {
+        return a->getParent() == this;
+    }
+    ReverseArc *reverse(const Arc *a) const;
+
+    bool hasArcGreetingObservers() const {
+        return observableArcGreetings.hasObservers() || observableArcBatchGreetings.hasObservers();
+    }
+    bool hasArcFarewellObservers() const {
+        return observableArcFarewells.hasObservers() || observableArcBatchFarewells.hasObservers();
+    }
+
+    // translate an arc added to or removed from the wrapped graph
+    // into greetArc()/dismissArc() calls
+    virtual void forwardArcGreeting(Arc *a) = 0;
+    virtual void forwardArcFarewell(Arc *a) = 0;
+
+private:
+    mutable FastPropertyMap<ReverseArc*> reverseArcs;
+    std::vector<ReverseArc*> retiredArcs;
+
+    void releaseReverseArc(const Arc *a);
+    void deleteRetiredArcs();
+};
+
+}
+
+#endif // ARCREVERSINGVIEW_H
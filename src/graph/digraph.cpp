@@ -23,7 +23,10 @@
 #include "digraph.h"
 #include "arc.h"
 
+#include <exception>
+#include <functional>
 #include <sstream>
+#include <stdexcept>
 
 namespace Algora {
 
@@ -75,11 +78,122 @@ void DiGraph::removeOnArcRemove(void *id)
     observableArcFarewells.removeObserver(id);
 }
 
+void DiGraph::onArcsAdd(void *id, const ArcBatchMapping &avFun)
+{
+    observableArcBatchGreetings.addObserver(id, avFun);
+}
+
+void DiGraph::onArcsRemove(void *id, const ArcBatchMapping &avFun)
+{
+    observableArcBatchFarewells.addObserver(id, avFun);
+}
+
+void DiGraph::removeOnArcsAdd(void *id)
+{
+    observableArcBatchGreetings.removeObserver(id);
+}
+
+void DiGraph::removeOnArcsRemove(void *id)
+{
+    observableArcBatchFarewells.removeObserver(id);
+}
+
+void DiGraph::beginTransaction()
+{
+    transactionDepth++;
+}
+
+void DiGraph::commitTransaction()
+{
+    if (transactionDepth == 0U) {
+        throw std::logic_error("No transaction in progress.");
+    }
+    transactionDepth--;
+    if (transactionDepth > 0U) {
+        return;
+    }
+
+    // observers may modify the graph again
+    std::vector<Vertex*> addedVertices;
+    std::vector<Vertex*> removedVertices;
+    std::vector<Arc*> addedArcs;
+    std::vector<Arc*> removedArcs;
+    addedVertices.swap(pendingVertexGreetings);
+    removedVertices.swap(pendingVertexFarewells);
+    addedArcs.swap(pendingArcGreetings);
+    removedArcs.swap(pendingArcFarewells);
+    cancelOpposites(addedVertices, removedVertices);
+    cancelOpposites(addedArcs, removedArcs);
+
+    std::exception_ptr error;
+    auto deliver = [&error](const std::function<void()> &notify) {
+        try {
+            notify();
+        } catch (...) {
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    };
+    deliver([&]() { deliverVertexGreetings(addedVertices); });
+    deliver([&]() { deliverArcGreetings(addedArcs); });
+    deliver([&]() { deliverArcFarewells(removedArcs); });
+    deliver([&]() { deliverVertexFarewells(removedVertices); });
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
 void DiGraph::clear()
 {
     Graph::clear();
 }
 
+MemoryReport DiGraph::memoryUsage() const
+{
+    MemoryReport report = Graph::memoryUsage();
+    report.add("observers", observableArcGreetings.memoryUsage()
+               + observableArcFarewells.memoryUsage()
+               + observableArcBatchGreetings.memoryUsage()
+               + observableArcBatchFarewells.memoryUsage());
+    report.add("pending notifications", MemoryUsage::of(pendingArcGreetings)
+               + MemoryUsage::of(pendingArcFarewells));
+    return report;
+}
+
+void DiGraph::shrinkToFit()
+{
+    Graph::shrinkToFit();
+    observableArcGreetings.fit();
+    observableArcFarewells.fit();
+    observableArcBatchGreetings.fit();
+    observableArcBatchFarewells.fit();
+    if (transactionDepth == 0U) {
+        pendingArcGreetings.shrink_to_fit();
+        pendingArcFarewells.shrink_to_fit();
+    }
+}
+
+void DiGraph::deliverArcGreetings(const std::vector<Arc*> &batch)
+{
+    if (batch.empty()) {
+        return;
+    }
+    auto legacy = [this](void *id) { return !observableArcBatchGreetings.hasObserver(id); };
+    observableArcGreetings.notifyObserversIfOfEach(legacy, batch);
+    observableArcBatchGreetings.notifyObservers(batch);
+}
+
+void DiGraph::deliverArcFarewells(const std::vector<Arc*> &batch)
+{
+    if (batch.empty()) {
+        return;
+    }
+    auto legacy = [this](void *id) { return !observableArcBatchFarewells.hasObserver(id); };
+    observableArcFarewells.notifyObserversIfOfEach(legacy, batch);
+    observableArcBatchFarewells.notifyObservers(batch);
+}
+
 std::string DiGraph::toString() const
 {
     std::ostringstream strStream;
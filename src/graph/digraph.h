@@ -80,6 +80,24 @@ public:
     virtual void removeOnArcAdd(void *id);
     virtual void removeOnArcRemove(void *id);
 
+    virtual void onArcsAdd(void *id, const ArcBatchMapping &avFun);
+    virtual void onArcsRemove(void *id, const ArcBatchMapping &avFun);
+    virtual void removeOnArcsAdd(void *id);
+    virtual void removeOnArcsRemove(void *id);
+
+    // Transactions
+    // While a transaction is in progress, observers are not notified of single
+    // changes. Instead, commitTransaction() delivers all added vertices, all added arcs,
+    // all removed arcs and all removed vertices, in this order, as one batch each.
+    // Observers that do not listen to batches are notified per element at this time.
+    // Artifacts that were added and removed again within the transaction are not reported.
+    // If an observer throws, the remaining notifications are still delivered and the first
+    // exception is rethrown afterwards.
+    // Transactions may be nested; notifications are delivered by the outermost commit.
+    virtual void beginTransaction();
+    virtual void commitTransaction();
+    bool isInTransaction() const { return transactionDepth > 0U; }
+
     // Accomodate visitors
     virtual void acceptArcVisitor(ArcVisitor *aVisitor) {
         mapArcs(aVisitor->getVisitorFunction());
@@ -102,6 +120,9 @@ public:
 
     virtual void clear() override;
 
+    virtual MemoryReport memoryUsage() const override;
+    virtual void shrinkToFit() override;
+
     // GraphArtifact interface
 public:
     virtual std::string toString() const override;
@@ -109,9 +130,31 @@ public:
 protected:
    Observable<Arc*> observableArcGreetings;
    Observable<Arc*> observableArcFarewells;
-
-   void greetArc(Arc *a) { observableArcGreetings.notifyObservers(a); }
-   void dismissArc(Arc *a) { observableArcFarewells.notifyObservers(a); }
+   Observable<const std::vector<Arc*>&> observableArcBatchGreetings;
+   Observable<const std::vector<Arc*>&> observableArcBatchFarewells;
+
+   std::vector<Arc*> pendingArcGreetings;
+   std::vector<Arc*> pendingArcFarewells;
+
+   void greetArc(Arc *a) {
+       if (transactionDepth == 0U) {
+           observableArcGreetings.notifyObservers(a);
+       } else if (observableArcGreetings.hasObservers()
+                  || observableArcBatchGreetings.hasObservers()) {
+           pendingArcGreetings.push_back(a);
+       }
+   }
+   void dismissArc(Arc *a) {
+       if (transactionDepth == 0U) {
+           observableArcFarewells.notifyObservers(a);
+       } else if (observableArcFarewells.hasObservers()
+                  || observableArcBatchFarewells.hasObservers()) {
+           pendingArcFarewells.push_back(a);
+       }
+   }
+
+   void deliverArcGreetings(const std::vector<Arc*> &batch);
+   void deliverArcFarewells(const std::vector<Arc*> &batch);
 
     virtual Arc *createArc(Vertex *tail, Vertex *head) {
         return new Arc(tail, head, this);
@@ -25,10 +25,10 @@
 namespace Algora {
 
 Graph::Graph(GraphArtifact *parent)
-    : GraphArtifact(parent) { }
+    : GraphArtifact(parent), transactionDepth(0U) { }
 
 Graph::Graph(const Graph &other)
-    : GraphArtifact(other)
+    : GraphArtifact(other), transactionDepth(0U)
 {
     // do not copy observers
 }
@@ -63,8 +63,72 @@ void Graph::removeOnVertexRemove(void *id)
     observableVertexFarewells.removeObserver(id);
 }
 
+void Graph::onVerticesAdd(void *id, const VertexBatchMapping &vvFun)
+{
+    observableVertexBatchGreetings.addObserver(id, vvFun);
+}
+
+void Graph::onVerticesRemove(void *id, const VertexBatchMapping &vvFun)
+{
+    observableVertexBatchFarewells.addObserver(id, vvFun);
+}
+
+void Graph::removeOnVerticesAdd(void *id)
+{
+    observableVertexBatchGreetings.removeObserver(id);
+}
+
+void Graph::removeOnVerticesRemove(void *id)
+{
+    observableVertexBatchFarewells.removeObserver(id);
+}
+
 void Graph::clear()
 {
 }
 
+MemoryReport Graph::memoryUsage() const
+{
+    MemoryReport report;
+    report.add("observers", observableVertexGreetings.memoryUsage()
+               + observableVertexFarewells.memoryUsage()
+               + observableVertexBatchGreetings.memoryUsage()
+               + observableVertexBatchFarewells.memoryUsage());
+    report.add("pending notifications", MemoryUsage::of(pendingVertexGreetings)
+               + MemoryUsage::of(pendingVertexFarewells));
+    return report;
+}
+
+void Graph::shrinkToFit()
+{
+    observableVertexGreetings.fit();
+    observableVertexFarewells.fit();
+    observableVertexBatchGreetings.fit();
+    observableVertexBatchFarewells.fit();
+    if (transactionDepth == 0U) {
+        pendingVertexGreetings.shrink_to_fit();
+        pendingVertexFarewells.shrink_to_fit();
+    }
+}
+
+void Graph::deliverVertexGreetings(const std::vector<Vertex*> &batch)
+{
+    if (batch.empty()) {
+        return;
+    }
+    auto legacy = [this](void *id) { return !observableVertexBatchGreetings.hasObserver(id); };
+    observableVertexGreetings.notifyObserversIfOfEach(legacy, batch);
+    observableVertexBatchGreetings.notifyObservers(batch);
+}
+
+void Graph::deliverVertexFarewells(const std::vector<Vertex*> &batch)
+{
+    if (batch.empty()) {
+        return;
+    }
+    auto legacy = [this](void *id) { return !observableVertexBatchFarewells.hasObserver(id); };
+    observableVertexFarewells.notifyObserversIfOfEach(legacy, batch);
+    observableVertexBatchFarewells.notifyObservers(batch);
+}
+
 }
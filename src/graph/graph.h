@@ -29,7 +29,9 @@
 #include "graph.visitor/vertexvisitor.h"
 #include "graph_functional.h"
 #include "observable.h"
+#include "memoryusage.h"
 
+#include <unordered_map>
 #include <vector>
 
 namespace Algora {
@@ -63,6 +65,14 @@ public:
     virtual void removeOnVertexAdd(void *id);
     virtual void removeOnVertexRemove(void *id);
 
+    // Batch observers are notified once per transaction (see DiGraph::beginTransaction()).
+    // An observer that is registered under the same id for single and batch notifications
+    // receives only the batch for changes made during a transaction.
+    virtual void onVerticesAdd(void *id, const VertexBatchMapping &vvFun);
+    virtual void onVerticesRemove(void *id, const VertexBatchMapping &vvFun);
+    virtual void removeOnVerticesAdd(void *id);
+    virtual void removeOnVerticesRemove(void *id);
+
     // Accomodate visitors
     virtual void acceptVertexVisitor(VertexVisitor *nVisitor) {
         mapVertices(nVisitor->getVisitorFunction());
@@ -78,12 +88,79 @@ public:
 
     virtual void clear();
 
+    // bytes used and reserved, broken down by part; the vertex and arc
+    // objects handed out are included, property maps of clients are not
+    virtual MemoryReport memoryUsage() const;
+    // releases unused reserves, e.g., pooled vertices and arcs
+    virtual void shrinkToFit();
+
 protected:
    Observable<Vertex*> observableVertexGreetings;
    Observable<Vertex*> observableVertexFarewells;
-
-   void greetVertex(Vertex *v) { observableVertexGreetings.notifyObservers(v); }
-   void dismissVertex(Vertex *v) { observableVertexFarewells.notifyObservers(v); }
+   Observable<const std::vector<Vertex*>&> observableVertexBatchGreetings;
+   Observable<const std::vector<Vertex*>&> observableVertexBatchFarewells;
+
+   unsigned int transactionDepth;
+   std::vector<Vertex*> pendingVertexGreetings;
+   std::vector<Vertex*> pendingVertexFarewells;
+
+   void greetVertex(Vertex *v) {
+       if (transactionDepth == 0U) {
+           observableVertexGreetings.notifyObservers(v);
+       } else if (observableVertexGreetings.hasObservers()
+                  || observableVertexBatchGreetings.hasObservers()) {
+           pendingVertexGreetings.push_back(v);
+       }
+   }
+   void dismissVertex(Vertex *v) {
+       if (transactionDepth == 0U) {
+           observableVertexFarewells.notifyObservers(v);
+       } else if (observableVertexFarewells.hasObservers()
+                  || observableVertexBatchFarewells.hasObservers()) {
+           pendingVertexFarewells.push_back(v);
+       }
+   }
+
+   void deliverVertexGreetings(const std::vector<Vertex*> &batch);
+   void deliverVertexFarewells(const std::vector<Vertex*> &batch);
+
+   // drops artifacts that were both added and removed from both lists,
+   // keeping the order of the others
+   template<typename T>
+   static void cancelOpposites(std::vector<T*> &added, std::vector<T*> &removed) {
+       if (added.empty() || removed.empty()) {
+           return;
+       }
+       std::unordered_map<T*, size_type> unmatched;
+       for (T *t : removed) {
+           unmatched[t]++;
+       }
+       std::unordered_map<T*, size_type> matched;
+       auto out = added.begin();
+       for (T *t : added) {
+           auto i = unmatched.find(t);
+           if (i != unmatched.end() && i->second > 0U) {
+               i->second--;
+               matched[t]++;
+           } else {
+               *out++ = t;
+           }
+       }
+       added.erase(out, added.end());
+       if (matched.empty()) {
+           return;
+       }
+       out = removed.begin();
+       for (T *t : removed) {
+           auto i = matched.find(t);
+           if (i != matched.end() && i->second > 0U) {
+               i->second--;
+           } else {
+               *out++ = t;
+           }
+       }
+       removed.erase(out, removed.end());
+   }
 
     Vertex *createVertex() {
         return new Vertex(this);
@@ -24,18 +24,23 @@ message("pri file being processed: $$PWD")
 
 HEADERS += \
     $$PWD/graphartifact.h \
+    $$PWD/idmapping.h \
     $$PWD/digraph.h \
     $$PWD/vertex.h \
     $$PWD/arc.h \
     $$PWD/parallelarcsbundle.h \
     $$PWD/graph.h \
     $$PWD/subdigraph.h \
+    $$PWD/indexedsubdigraph.h \
     $$PWD/superdigraph.h \
     $$PWD/graph_functional.h \
     $$PWD/multiarc.h \
     $$PWD/weightedarc.h \
     $$PWD/vertexpair.h \
-    $$PWD/reversearc.h
+    $$PWD/reversearc.h \
+    $$PWD/arcreversingview.h \
+    $$PWD/reverseddigraph.h \
+    $$PWD/undirectedview.h
 
 SOURCES += \
     $$PWD/digraph.cpp \
@@ -43,10 +48,14 @@ SOURCES += \
     $$PWD/graphartifact.cpp \
     $$PWD/parallelarcsbundle.cpp \
     $$PWD/subdigraph.cpp \
+    $$PWD/indexedsubdigraph.cpp \
     $$PWD/superdigraph.cpp \
     $$PWD/graph_functional.cpp \
     $$PWD/multiarc.cpp \
     $$PWD/weightedarc.cpp \
     $$PWD/vertexpair.cpp \
     $$PWD/graph.cpp \
-    $$PWD/arc.cpp
+    $$PWD/arc.cpp \
+    $$PWD/arcreversingview.cpp \
+    $$PWD/reverseddigraph.cpp \
+    $$PWD/undirectedview.cpp
@@ -24,6 +24,7 @@
 #define GRAPH_FUNCTIONAL_H
 
 #include <functional>
+#include <vector>
 
 namespace Algora {
 
@@ -36,6 +37,9 @@ typedef std::function<void(Arc *a)> ArcMapping;
 typedef std::function<void(const Vertex *v)> ConstVertexMapping;
 typedef std::function<void(const Arc *a)> ConstArcMapping;
 
+typedef std::function<void(const std::vector<Vertex*> &vs)> VertexBatchMapping;
+typedef std::function<void(const std::vector<Arc*> &as)> ArcBatchMapping;
+
 typedef std::function<bool(const Vertex *v)> VertexPredicate;
 typedef std::function<bool(const Arc *v)> ArcPredicate;
 
@@ -26,7 +26,7 @@
 
 namespace Algora {
 
-GraphArtifact::id_type GraphArtifact::nextId = 0ULL;
+std::atomic<GraphArtifact::id_type> GraphArtifact::nextId(0ULL);
 
 GraphArtifact::GraphArtifact(id_type id, GraphArtifact *parent)
     : id(id), parent(parent), valid(true)
@@ -35,9 +35,8 @@ GraphArtifact::GraphArtifact(id_type id, GraphArtifact *parent)
 }
 
 GraphArtifact::GraphArtifact(GraphArtifact *parent)
-    : id(nextId), parent(parent), valid(true)
+    : id(nextId++), parent(parent), valid(true)
 {
-    nextId++;
 }
 
 GraphArtifact::~GraphArtifact()
@@ -45,9 +44,8 @@ GraphArtifact::~GraphArtifact()
 }
 
 GraphArtifact::GraphArtifact(const GraphArtifact &other)
-    : id(nextId), parent(other.parent), valid(other.valid), name(other.name)
+    : id(nextId++), parent(other.parent), valid(other.valid), name(other.name)
 {
-    nextId++;
 }
 
 GraphArtifact &GraphArtifact::operator=(const GraphArtifact &other)
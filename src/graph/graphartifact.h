@@ -24,6 +24,7 @@
 #define GRAPHARTIFACT_H
 
 #include <string>
+#include <atomic>
 
 namespace Algora {
 
@@ -71,9 +72,12 @@ protected:
     std::string idString() const;
     void invalidate() { valid = false; }
     void revalidate() { valid = true; }
+    // only for graphs that renumber their artifacts
+    void setId(id_type i) { id = i; }
 
 private:
-    static id_type nextId;
+    // atomic, so that artifacts may be created in several threads
+    static std::atomic<id_type> nextId;
 
     id_type id;
     GraphArtifact *parent;
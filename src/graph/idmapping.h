@@ -0,0 +1,63 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef IDMAPPING_H
+#define IDMAPPING_H
+
+#include "graphartifact.h"
+
+#include <vector>
+#include <limits>
+#include <utility>
+#include <algorithm>
+
+namespace Algora {
+
+// Renumbering of graph artifacts: entry i holds the new id of the artifact
+// that had id i, or NO_ID if there was no such artifact.
+typedef std::vector<GraphArtifact::id_type> IdMapping;
+constexpr GraphArtifact::id_type NO_ID = std::numeric_limits<GraphArtifact::id_type>::max();
+
+// Moves values[i] to values[mapping[i]]; values of unmapped ids are dropped,
+// new slots get fill.
+template<typename T, typename A>
+void permuteById(std::vector<T, A> &values, const IdMapping &mapping, const T &fill)
+{
+    auto n = std::min(values.size(), mapping.size());
+    typename std::vector<T, A>::size_type size = 0U;
+    for (auto i = 0ULL; i < mapping.size(); i++) {
+        if (mapping[i] != NO_ID && mapping[i] >= size) {
+            size = mapping[i] + 1U;
+        }
+    }
+    std::vector<T, A> permuted(size, fill);
+    for (auto i = 0ULL; i < n; i++) {
+        if (mapping[i] != NO_ID) {
+            permuted[mapping[i]] = std::move(values[i]);
+        }
+    }
+    values.swap(permuted);
+}
+
+}
+
+#endif // IDMAPPING_H
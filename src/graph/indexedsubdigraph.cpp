@@ -0,0 +1,366 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "indexedsubdigraph.h"
+
+#include "vertex.h"
+#include "arc.h"
+#include "multiarc.h"
+
+#include <stdexcept>
+
+namespace Algora {
+
+IndexedSubDiGraph::IndexedSubDiGraph(DiGraph *graph,
+                                     const VertexPredicate &autoIncludeVertex,
+                                     const ArcPredicate &autoIncludeArc)
+    : superGraph(graph), autoIncludeVertex(autoIncludeVertex), autoIncludeArc(autoIncludeArc)
+{
+    graph->onVertexAdd(this, [this](Vertex *v) { autoInclude(v); });
+    graph->onArcAdd(this, [this](Arc *a) { autoInclude(a); });
+    // the supergraph dismisses incident arcs before their end vertices
+    graph->onVertexRemove(this, [this](Vertex *v) { dropVertex(v); });
+    graph->onArcRemove(this, [this](Arc *a) { dropArc(a); });
+
+    // forward batches as batches
+    graph->onVerticesAdd(this, [this](const std::vector<Vertex*> &vertices) {
+        beginTransaction();
+        for (Vertex *v : vertices) {
+            autoInclude(v);
+        }
+        commitTransaction();
+    });
+    graph->onArcsAdd(this, [this](const std::vector<Arc*> &arcs) {
+        beginTransaction();
+        for (Arc *a : arcs) {
+            autoInclude(a);
+        }
+        commitTransaction();
+    });
+    graph->onVerticesRemove(this, [this](const std::vector<Vertex*> &vertices) {
+        beginTransaction();
+        for (Vertex *v : vertices) {
+            dropVertex(v);
+        }
+        commitTransaction();
+    });
+    graph->onArcsRemove(this, [this](const std::vector<Arc*> &arcs) {
+        beginTransaction();
+        for (Arc *a : arcs) {
+            dropArc(a);
+        }
+        commitTransaction();
+    });
+}
+
+IndexedSubDiGraph::~IndexedSubDiGraph()
+{
+    superGraph->removeOnVertexAdd(this);
+    superGraph->removeOnVertexRemove(this);
+    superGraph->removeOnArcAdd(this);
+    superGraph->removeOnArcRemove(this);
+    superGraph->removeOnVerticesAdd(this);
+    superGraph->removeOnVerticesRemove(this);
+    superGraph->removeOnArcsAdd(this);
+    superGraph->removeOnArcsRemove(this);
+}
+
+bool IndexedSubDiGraph::includeVertex(Vertex *v)
+{
+    if (!superGraph->containsVertex(v)) {
+        throw std::invalid_argument("Vertex is not a part of the supergraph.");
+    }
+    if (!vertexSet.add(v)) {
+        return false;
+    }
+    greetVertex(v);
+    return true;
+}
+
+bool IndexedSubDiGraph::includeArc(Arc *a)
+{
+    if (!superGraph->containsArc(a)) {
+        throw std::invalid_argument("Arc is not a part of the supergraph.");
+    }
+    if (!hasEndVertices(a)) {
+        throw std::invalid_argument("End vertices of arc are not a part of this graph.");
+    }
+    if (!arcSet.add(a)) {
+        return false;
+    }
+    greetArc(a);
+    return true;
+}
+
+void IndexedSubDiGraph::autoInclude(Vertex *v)
+{
+    // an earlier observer may have removed v from the supergraph again
+    if (superGraph->containsVertex(v) && autoIncludeVertex(v) && vertexSet.add(v)) {
+        greetVertex(v);
+    }
+}
+
+void IndexedSubDiGraph::autoInclude(Arc *a)
+{
+    if (superGraph->containsArc(a) && hasEndVertices(a) && autoIncludeArc(a) && arcSet.add(a)) {
+        greetArc(a);
+    }
+}
+
+bool IndexedSubDiGraph::excludeVertex(Vertex *v)
+{
+    if (!vertexSet.contains(v)) {
+        return false;
+    }
+    std::vector<Arc*> incidentArcs;
+    auto collect = [this,&incidentArcs](Arc *a) {
+        if (arcSet.contains(a)) {
+            incidentArcs.push_back(a);
+        }
+    };
+    superGraph->mapOutgoingArcs(v, collect);
+    superGraph->mapIncomingArcs(v, collect);
+
+    beginTransaction();
+    for (Arc *a : incidentArcs) {
+        // loops are listed twice
+        dropArc(a);
+    }
+    dropVertex(v);
+    commitTransaction();
+    return true;
+}
+
+bool IndexedSubDiGraph::excludeArc(Arc *a)
+{
+    if (!arcSet.contains(a)) {
+        return false;
+    }
+    dropArc(a);
+    return true;
+}
+
+Vertex *IndexedSubDiGraph::addVertex()
+{
+    Vertex *v = superGraph->addVertex();
+    // might have been included automatically
+    includeVertex(v);
+    return v;
+}
+
+void IndexedSubDiGraph::removeVertex(Vertex *v)
+{
+    if (!vertexSet.contains(v)) {
+        throw std::invalid_argument("Vertex is not a part of this graph.");
+    }
+    superGraph->removeVertex(v);
+}
+
+bool IndexedSubDiGraph::containsVertex(const Vertex *v) const
+{
+    return vertexSet.contains(v);
+}
+
+Vertex *IndexedSubDiGraph::getAnyVertex() const
+{
+    return vertexSet.members.empty() ? nullptr : vertexSet.members.front();
+}
+
+void IndexedSubDiGraph::mapVerticesUntil(const VertexMapping &vvFun, const VertexPredicate &breakCondition)
+{
+    for (Vertex *v : vertexSet.members) {
+        if (breakCondition(v)) {
+            break;
+        }
+        vvFun(v);
+    }
+}
+
+bool IndexedSubDiGraph::isEmpty() const
+{
+    return vertexSet.members.empty();
+}
+
+Graph::size_type IndexedSubDiGraph::getSize() const
+{
+    return vertexSet.members.size();
+}
+
+Arc *IndexedSubDiGraph::addArc(Vertex *tail, Vertex *head)
+{
+    if (!vertexSet.contains(tail) || !vertexSet.contains(head)) {
+        throw std::invalid_argument("Vertex is not a part of this graph.");
+    }
+    Arc *a = superGraph->addArc(tail, head);
+    includeArc(a);
+    return a;
+}
+
+MultiArc *IndexedSubDiGraph::addMultiArc(Vertex *tail, Vertex *head, size_type size)
+{
+    if (size <= 0ULL) {
+        throw std::invalid_argument("Multiarcs must be of size at least 1.");
+    }
+    if (!vertexSet.contains(tail) || !vertexSet.contains(head)) {
+        throw std::invalid_argument("Vertex is not a part of this graph.");
+    }
+    MultiArc *a = superGraph->addMultiArc(tail, head, size);
+    includeArc(a);
+    return a;
+}
+
+void IndexedSubDiGraph::removeArc(Arc *a)
+{
+    if (!arcSet.contains(a)) {
+        throw std::invalid_argument("Arc is not a part of this graph.");
+    }
+    superGraph->removeArc(a);
+}
+
+bool IndexedSubDiGraph::containsArc(const Arc *a) const
+{
+    return arcSet.contains(a);
+}
+
+Arc *IndexedSubDiGraph::findArc(const Vertex *from, const Vertex *to) const
+{
+    if (!vertexSet.contains(from) || !vertexSet.contains(to)) {
+        return nullptr;
+    }
+    Arc *arc = nullptr;
+    superGraph->mapOutgoingArcsUntil(from, [&](Arc *a) {
+        if (a->getHead() == to && arcSet.contains(a)) {
+            arc = a;
+        }
+    }, [&arc](const Arc *) { return arc != nullptr; });
+    return arc;
+}
+
+Graph::size_type IndexedSubDiGraph::getOutDegree(const Vertex *v, bool multiArcsAsSimple) const
+{
+    if (!vertexSet.contains(v)) {
+        throw std::invalid_argument("Vertex is not a part of this graph.");
+    }
+    size_type out = 0;
+    superGraph->mapOutgoingArcs(v, [&](Arc *a) {
+        if (arcSet.contains(a)) {
+            out += multiArcsAsSimple ? 1 : a->getSize();
+        }
+    });
+    return out;
+}
+
+Graph::size_type IndexedSubDiGraph::getInDegree(const Vertex *v, bool multiArcsAsSimple) const
+{
+    if (!vertexSet.contains(v)) {
+        throw std::invalid_argument("Vertex is not a part of this graph.");
+    }
+    size_type in = 0;
+    superGraph->mapIncomingArcs(v, [&](Arc *a) {
+        if (arcSet.contains(a)) {
+            in += multiArcsAsSimple ? 1 : a->getSize();
+        }
+    });
+    return in;
+}
+
+Graph::size_type IndexedSubDiGraph::getNumArcs(bool multiArcsAsSimple) const
+{
+    if (multiArcsAsSimple) {
+        return arcSet.members.size();
+    }
+    size_type numArcs = 0;
+    for (const Arc *a : arcSet.members) {
+        numArcs += a->getSize();
+    }
+    return numArcs;
+}
+
+void IndexedSubDiGraph::mapArcsUntil(const ArcMapping &avFun, const ArcPredicate &breakCondition)
+{
+    for (Arc *a : arcSet.members) {
+        if (breakCondition(a)) {
+            break;
+        }
+        avFun(a);
+    }
+}
+
+void IndexedSubDiGraph::mapOutgoingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition)
+{
+    if (!vertexSet.contains(v)) {
+        throw std::invalid_argument("Vertex is not a part of this graph.");
+    }
+    superGraph->mapOutgoingArcsUntil(v, [&](Arc *a) {
+        if (arcSet.contains(a)) {
+            avFun(a);
+        }
+    }, [&](const Arc *a) { return arcSet.contains(a) && breakCondition(a); });
+}
+
+void IndexedSubDiGraph::mapIncomingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition)
+{
+    if (!vertexSet.contains(v)) {
+        throw std::invalid_argument("Vertex is not a part of this graph.");
+    }
+    superGraph->mapIncomingArcsUntil(v, [&](Arc *a) {
+        if (arcSet.contains(a)) {
+            avFun(a);
+        }
+    }, [&](const Arc *a) { return arcSet.contains(a) && breakCondition(a); });
+}
+
+void IndexedSubDiGraph::clear()
+{
+    beginTransaction();
+    for (Arc *a : arcSet.members) {
+        dismissArc(a);
+    }
+    for (Vertex *v : vertexSet.members) {
+        dismissVertex(v);
+    }
+    arcSet.clear();
+    vertexSet.clear();
+    commitTransaction();
+    DiGraph::clear();
+}
+
+bool IndexedSubDiGraph::hasEndVertices(const Arc *a) const
+{
+    return vertexSet.contains(a->getTail()) && vertexSet.contains(a->getHead());
+}
+
+void IndexedSubDiGraph::dropVertex(Vertex *v)
+{
+    if (vertexSet.remove(v)) {
+        dismissVertex(v);
+    }
+}
+
+void IndexedSubDiGraph::dropArc(Arc *a)
+{
+    if (arcSet.remove(a)) {
+        dismissArc(a);
+    }
+}
+
+}
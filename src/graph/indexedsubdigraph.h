@@ -0,0 +1,148 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef INDEXEDSUBDIGRAPH_H
+#define INDEXEDSUBDIGRAPH_H
+
+#include "digraph.h"
+#include "property/propertymap.h"
+
+#include <vector>
+
+namespace Algora {
+
+// Subgraph view that keeps explicit lists of its vertices and arcs,
+// so that size queries and vertex/arc iteration do not depend on the size
+// of the supergraph.
+// Membership is defined by includeVertex()/includeArc() and the optional
+// auto-inclusion predicates that are evaluated whenever the supergraph
+// greets a new vertex or arc. An arc can only be included if both its
+// end vertices are part of the subgraph.
+class IndexedSubDiGraph : public DiGraph
+{
+public:
+    explicit IndexedSubDiGraph(DiGraph *graph,
+                               const VertexPredicate &autoIncludeVertex = vertexFalse,
+                               const ArcPredicate &autoIncludeArc = arcFalse);
+    virtual ~IndexedSubDiGraph() override;
+
+    IndexedSubDiGraph(const IndexedSubDiGraph &other) = delete;
+    IndexedSubDiGraph &operator=(const IndexedSubDiGraph &other) = delete;
+
+    DiGraph *getSuperGraph() const { return superGraph; }
+
+    bool includeVertex(Vertex *v);
+    bool includeArc(Arc *a);
+    bool excludeVertex(Vertex *v);
+    bool excludeArc(Arc *a);
+
+    // Graph interface
+public:
+    virtual Vertex *addVertex() override;
+    virtual void removeVertex(Vertex *v) override;
+    virtual bool containsVertex(const Vertex *v) const override;
+    virtual Vertex *getAnyVertex() const override;
+    virtual void mapVerticesUntil(const VertexMapping &vvFun, const VertexPredicate &breakCondition) override;
+    virtual bool isEmpty() const override;
+    virtual size_type getSize() const override;
+
+    // DiGraph interface
+public:
+    using DiGraph::mapArcs;
+    using DiGraph::mapOutgoingArcsUntil;
+    using DiGraph::mapIncomingArcsUntil;
+
+    virtual Arc *addArc(Vertex *tail, Vertex *head) override;
+    virtual MultiArc *addMultiArc(Vertex *tail, Vertex *head, size_type size) override;
+    virtual void removeArc(Arc *a) override;
+    virtual bool containsArc(const Arc *a) const override;
+    virtual Arc *findArc(const Vertex *from, const Vertex *to) const override;
+    virtual size_type getOutDegree(const Vertex *v, bool multiArcsAsSimple = false) const override;
+    virtual size_type getInDegree(const Vertex *v, bool multiArcsAsSimple = false) const override;
+    virtual size_type getNumArcs(bool multiArcsAsSimple = false) const override;
+    virtual void mapArcsUntil(const ArcMapping &avFun, const ArcPredicate &breakCondition) override;
+    virtual void mapOutgoingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition) override;
+    virtual void mapIncomingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition) override;
+    // removes all vertices and arcs from the view, but not from the supergraph
+    virtual void clear() override;
+
+private:
+    // dense member list plus position index, cf. FastVertexSet;
+    // the index is hash-based so that its size depends on the size of the
+    // view only, not on the id range of the supergraph
+    template<typename T>
+    struct MemberSet {
+        std::vector<T*> members;
+        PropertyMap<size_type> index;
+
+        MemberSet() : index(0U) { }
+
+        bool contains(const T *t) const {
+            return index.getValue(t) > 0U;
+        }
+
+        bool add(T *t) {
+            if (contains(t)) {
+                return false;
+            }
+            members.push_back(t);
+            index[t] = members.size();
+            return true;
+        }
+
+        bool remove(T *t) {
+            auto pos = index.getValue(t);
+            if (pos == 0U) {
+                return false;
+            }
+            members[pos - 1U] = members.back();
+            members.pop_back();
+            if (pos - 1U < members.size()) {
+                index[members[pos - 1U]] = pos;
+            }
+            index.resetToDefault(t);
+            return true;
+        }
+
+        void clear() {
+            members.clear();
+            index.resetAll();
+        }
+    };
+
+    DiGraph *superGraph;
+    VertexPredicate autoIncludeVertex;
+    ArcPredicate autoIncludeArc;
+    MemberSet<Vertex> vertexSet;
+    MemberSet<Arc> arcSet;
+
+    bool hasEndVertices(const Arc *a) const;
+    // used by the observers of the supergraph, do not throw
+    void autoInclude(Vertex *v);
+    void autoInclude(Arc *a);
+    void dropVertex(Vertex *v);
+    void dropArc(Arc *a);
+};
+
+}
+
+#endif // INDEXEDSUBDIGRAPH_H
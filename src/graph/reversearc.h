@@ -31,6 +31,9 @@ class ReverseArc : public Arc
 {
 public:
     ReverseArc(Arc *a) : Arc(a->getHead(), a->getTail(), a->getParent()), arc(a) { }
+    // shares the id of a, so that id-based properties apply to both
+    ReverseArc(Arc *a, GraphArtifact *parent)
+        : Arc(a->getHead(), a->getTail(), a->getId(), parent), arc(a) { }
     virtual ~ReverseArc() override {}
 
     // GraphArtifact interface
@@ -42,6 +45,8 @@ public:
 public:
     virtual size_type getSize() const override { return arc->getSize(); }
 
+    Arc *getReversedArc() const { return arc; }
+
 private:
     Arc *arc;
 };
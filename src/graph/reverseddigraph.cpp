@@ -0,0 +1,113 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "reverseddigraph.h"
+
+#include <stdexcept>
+
+namespace Algora {
+
+ReversedDiGraph::ReversedDiGraph(DiGraph *graph)
+    : ArcReversingView(graph)
+{
+
+}
+
+Arc *ReversedDiGraph::addArc(Vertex *tail, Vertex *head)
+{
+    return reverse(superGraph->addArc(head, tail));
+}
+
+MultiArc *ReversedDiGraph::addMultiArc(Vertex *, Vertex *, Graph::size_type)
+{
+    throw std::logic_error("Multiarcs cannot be added to a reversed graph.");
+}
+
+bool ReversedDiGraph::containsArc(const Arc *a) const
+{
+    return isReverseArc(a) && superGraph->containsArc(getOriginalArc(a));
+}
+
+Arc *ReversedDiGraph::findArc(const Vertex *from, const Vertex *to) const
+{
+    Arc *a = superGraph->findArc(to, from);
+    return a ? reverse(a) : nullptr;
+}
+
+Graph::size_type ReversedDiGraph::getOutDegree(const Vertex *v, bool multiArcsAsSimple) const
+{
+    return superGraph->getInDegree(v, multiArcsAsSimple);
+}
+
+Graph::size_type ReversedDiGraph::getInDegree(const Vertex *v, bool multiArcsAsSimple) const
+{
+    return superGraph->getOutDegree(v, multiArcsAsSimple);
+}
+
+bool ReversedDiGraph::isSource(const Vertex *v) const
+{
+    return superGraph->isSink(v);
+}
+
+bool ReversedDiGraph::isSink(const Vertex *v) const
+{
+    return superGraph->isSource(v);
+}
+
+Graph::size_type ReversedDiGraph::getNumArcs(bool multiArcsAsSimple) const
+{
+    return superGraph->getNumArcs(multiArcsAsSimple);
+}
+
+void ReversedDiGraph::mapArcsUntil(const ArcMapping &avFun, const ArcPredicate &breakCondition)
+{
+    superGraph->mapArcsUntil([&](Arc *a) { avFun(reverse(a)); },
+        [&](const Arc *a) { return breakCondition(reverse(a)); });
+}
+
+void ReversedDiGraph::mapOutgoingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition)
+{
+    superGraph->mapIncomingArcsUntil(v, [&](Arc *a) { avFun(reverse(a)); },
+        [&](const Arc *a) { return breakCondition(reverse(a)); });
+}
+
+void ReversedDiGraph::mapIncomingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition)
+{
+    superGraph->mapOutgoingArcsUntil(v, [&](Arc *a) { avFun(reverse(a)); },
+        [&](const Arc *a) { return breakCondition(reverse(a)); });
+}
+
+void ReversedDiGraph::forwardArcGreeting(Arc *a)
+{
+    if (hasArcGreetingObservers()) {
+        greetArc(reverse(a));
+    }
+}
+
+void ReversedDiGraph::forwardArcFarewell(Arc *a)
+{
+    if (hasArcFarewellObservers()) {
+        dismissArc(reverse(a));
+    }
+}
+
+}
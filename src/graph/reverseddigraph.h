@@ -0,0 +1,66 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef REVERSEDDIGRAPH_H
+#define REVERSEDDIGRAPH_H
+
+#include "arcreversingview.h"
+
+namespace Algora {
+
+// Transpose of another graph: every arc (u, v) of the wrapped graph is
+// presented as (v, u). The graph is not copied (see ArcReversingView for the
+// cost of reversed arcs), modifications are passed through.
+class ReversedDiGraph : public ArcReversingView
+{
+public:
+    explicit ReversedDiGraph(DiGraph *graph);
+    virtual ~ReversedDiGraph() override { }
+
+    // DiGraph interface
+public:
+    using DiGraph::mapArcs;
+    using DiGraph::mapOutgoingArcsUntil;
+    using DiGraph::mapIncomingArcsUntil;
+
+    virtual Arc *addArc(Vertex *tail, Vertex *head) override;
+    virtual MultiArc *addMultiArc(Vertex *tail, Vertex *head, size_type size) override;
+    virtual bool containsArc(const Arc *a) const override;
+    virtual Arc *findArc(const Vertex *from, const Vertex *to) const override;
+    virtual size_type getOutDegree(const Vertex *v, bool multiArcsAsSimple = false) const override;
+    virtual size_type getInDegree(const Vertex *v, bool multiArcsAsSimple = false) const override;
+    virtual bool isSource(const Vertex *v) const override;
+    virtual bool isSink(const Vertex *v) const override;
+    virtual size_type getNumArcs(bool multiArcsAsSimple = false) const override;
+    virtual void mapArcsUntil(const ArcMapping &avFun, const ArcPredicate &breakCondition) override;
+    virtual void mapOutgoingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition) override;
+    virtual void mapIncomingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition) override;
+
+    // ArcReversingView interface
+protected:
+    virtual void forwardArcGreeting(Arc *a) override;
+    virtual void forwardArcFarewell(Arc *a) override;
+};
+
+}
+
+#endif // REVERSEDDIGRAPH_H
@@ -54,6 +54,44 @@ SubDiGraph::SubDiGraph(DiGraph *graph, Property<bool> &inherit)
             dismissArc(a);
         }
     });
+
+    // forward batches as batches
+    graph->onVerticesAdd(this, [&](const std::vector<Vertex*> &vertices) {
+        beginTransaction();
+        for (Vertex *v : vertices) {
+            if (inSubGraph(v)) {
+                greetVertex(v);
+            }
+        }
+        commitTransaction();
+    });
+    graph->onVerticesRemove(this, [&](const std::vector<Vertex*> &vertices) {
+        beginTransaction();
+        for (Vertex *v : vertices) {
+            if (inSubGraph(v)) {
+                dismissVertex(v);
+            }
+        }
+        commitTransaction();
+    });
+    graph->onArcsAdd(this, [&](const std::vector<Arc*> &arcs) {
+        beginTransaction();
+        for (Arc *a : arcs) {
+            if (inSubGraph(a) && inSubGraph(a->getTail()) && inSubGraph(a->getHead())) {
+                greetArc(a);
+            }
+        }
+        commitTransaction();
+    });
+    graph->onArcsRemove(this, [&](const std::vector<Arc*> &arcs) {
+        beginTransaction();
+        for (Arc *a : arcs) {
+            if (inSubGraph(a) && inSubGraph(a->getTail()) && inSubGraph(a->getHead())) {
+                dismissArc(a);
+            }
+        }
+        commitTransaction();
+    });
 }
 
 SubDiGraph::~SubDiGraph()
@@ -62,6 +100,10 @@ SubDiGraph::~SubDiGraph()
     superGraph->removeOnVertexRemove(this);
     superGraph->removeOnArcAdd(this);
     superGraph->removeOnArcRemove(this);
+    superGraph->removeOnVerticesAdd(this);
+    superGraph->removeOnVerticesRemove(this);
+    superGraph->removeOnArcsAdd(this);
+    superGraph->removeOnArcsRemove(this);
 }
 
 Vertex *SubDiGraph::addVertex()
@@ -58,10 +58,7 @@ SuperDiGraph::SuperDiGraph(DiGraph *graph)
     : grin(new CheshireCat(graph))
 {
     grin->extra = new IncidenceListGraphImplementation(this);
-    graph->onVertexAdd(this, [&](Vertex *v) {
-        greetVertex(v);
-    });
-    graph->onVertexRemove(this, [&](Vertex *v) {
+    auto onSubVertexRemove = [this](Vertex *v) {
         dismissVertex(v);
         auto i = grin->map.find(v);
         if (i != grin->map.end()) {
@@ -71,13 +68,47 @@ SuperDiGraph::SuperDiGraph(DiGraph *graph)
             grin->extra->removeVertex(vertex);
             grin->map.erase(i);
         }
+    };
+    graph->onVertexAdd(this, [&](Vertex *v) {
+        greetVertex(v);
     });
+    graph->onVertexRemove(this, onSubVertexRemove);
     graph->onArcAdd(this, [&](Arc *a) {
         greetArc(a);
     });
     graph->onArcRemove(this, [&](Arc *a) {
         dismissArc(a);
     });
+
+    // forward batches as batches
+    graph->onVerticesAdd(this, [&](const std::vector<Vertex*> &vertices) {
+        beginTransaction();
+        for (Vertex *v : vertices) {
+            greetVertex(v);
+        }
+        commitTransaction();
+    });
+    graph->onVerticesRemove(this, [this,onSubVertexRemove](const std::vector<Vertex*> &vertices) {
+        beginTransaction();
+        for (Vertex *v : vertices) {
+            onSubVertexRemove(v);
+        }
+        commitTransaction();
+    });
+    graph->onArcsAdd(this, [&](const std::vector<Arc*> &arcs) {
+        beginTransaction();
+        for (Arc *a : arcs) {
+            greetArc(a);
+        }
+        commitTransaction();
+    });
+    graph->onArcsRemove(this, [&](const std::vector<Arc*> &arcs) {
+        beginTransaction();
+        for (Arc *a : arcs) {
+            dismissArc(a);
+        }
+        commitTransaction();
+    });
 }
 
 SuperDiGraph::~SuperDiGraph()
@@ -89,6 +120,10 @@ SuperDiGraph::~SuperDiGraph()
     grin->subGraph->removeOnVertexRemove(this);
     grin->subGraph->removeOnArcAdd(this);
     grin->subGraph->removeOnArcRemove(this);
+    grin->subGraph->removeOnVerticesAdd(this);
+    grin->subGraph->removeOnVerticesRemove(this);
+    grin->subGraph->removeOnArcsAdd(this);
+    grin->subGraph->removeOnArcsRemove(this);
     delete grin;
 }
 
@@ -0,0 +1,153 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "undirectedview.h"
+
+namespace Algora {
+
+UndirectedView::UndirectedView(DiGraph *graph)
+    : ArcReversingView(graph)
+{
+
+}
+
+Arc *UndirectedView::addArc(Vertex *tail, Vertex *head)
+{
+    return superGraph->addArc(tail, head);
+}
+
+MultiArc *UndirectedView::addMultiArc(Vertex *tail, Vertex *head, Graph::size_type size)
+{
+    return superGraph->addMultiArc(tail, head, size);
+}
+
+bool UndirectedView::containsArc(const Arc *a) const
+{
+    return superGraph->containsArc(getOriginalArc(a));
+}
+
+Arc *UndirectedView::findArc(const Vertex *from, const Vertex *to) const
+{
+    Arc *a = superGraph->findArc(from, to);
+    if (a) {
+        return a;
+    }
+    a = superGraph->findArc(to, from);
+    return a ? reverse(a) : nullptr;
+}
+
+Graph::size_type UndirectedView::getOutDegree(const Vertex *v, bool multiArcsAsSimple) const
+{
+    return superGraph->getOutDegree(v, multiArcsAsSimple) + superGraph->getInDegree(v, multiArcsAsSimple);
+}
+
+Graph::size_type UndirectedView::getInDegree(const Vertex *v, bool multiArcsAsSimple) const
+{
+    return getOutDegree(v, multiArcsAsSimple);
+}
+
+bool UndirectedView::isSource(const Vertex *v) const
+{
+    return superGraph->isIsolated(v);
+}
+
+bool UndirectedView::isSink(const Vertex *v) const
+{
+    return superGraph->isIsolated(v);
+}
+
+Graph::size_type UndirectedView::getNumArcs(bool multiArcsAsSimple) const
+{
+    return 2U * superGraph->getNumArcs(multiArcsAsSimple);
+}
+
+void UndirectedView::mapArcsUntil(const ArcMapping &avFun, const ArcPredicate &breakCondition)
+{
+    bool stop = false;
+    superGraph->mapArcsUntil([&](Arc *a) {
+        if (breakCondition(a)) {
+            stop = true;
+            return;
+        }
+        avFun(a);
+        Arc *r = reverse(a);
+        if (breakCondition(r)) {
+            stop = true;
+            return;
+        }
+        avFun(r);
+    }, [&stop](const Arc *) { return stop; });
+}
+
+void UndirectedView::mapOutgoingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition)
+{
+    mapIncidentArcsUntil(v, true, avFun, breakCondition);
+}
+
+void UndirectedView::mapIncomingArcsUntil(const Vertex *v, const ArcMapping &avFun, const ArcPredicate &breakCondition)
+{
+    mapIncidentArcsUntil(v, false, avFun, breakCondition);
+}
+
+void UndirectedView::forwardArcGreeting(Arc *a)
+{
+    if (hasArcGreetingObservers()) {
+        greetArc(a);
+        greetArc(reverse(a));
+    }
+}
+
+void UndirectedView::forwardArcFarewell(Arc *a)
+{
+    if (hasArcFarewellObservers()) {
+        dismissArc(reverse(a));
+        dismissArc(a);
+    }
+}
+
+void UndirectedView::mapIncidentArcsUntil(const Vertex *v, bool outgoing,
+                                          const ArcMapping &avFun, const ArcPredicate &breakCondition)
+{
+    bool stop = false;
+    auto asIs = [&](Arc *a) {
+        if (breakCondition(a)) {
+            stop = true;
+        } else {
+            avFun(a);
+        }
+    };
+    auto reversed = [&](Arc *a) { asIs(reverse(a)); };
+    auto stopped = [&stop](const Arc *) { return stop; };
+    if (outgoing) {
+        superGraph->mapOutgoingArcsUntil(v, asIs, stopped);
+        if (!stop) {
+            superGraph->mapIncomingArcsUntil(v, reversed, stopped);
+        }
+    } else {
+        superGraph->mapIncomingArcsUntil(v, asIs, stopped);
+        if (!stop) {
+            superGraph->mapOutgoingArcsUntil(v, reversed, stopped);
+        }
+    }
+}
+
+}
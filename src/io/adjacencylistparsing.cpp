@@ -0,0 +1,63 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "adjacencylistparsing.h"
+
+#include <cctype>
+#include <charconv>
+#include <sstream>
+
+namespace Algora {
+
+namespace AdjacencyListParsing {
+
+bool parseInt(const std::string &s, int *i, std::string &err)
+{
+    using namespace std;
+    const char *begin = s.data();
+    const char *end = begin + s.length();
+    while (begin != end && isspace(static_cast<unsigned char>(*begin))) {
+        begin++;
+    }
+    if (begin != end && *begin == '+' && begin + 1 != end && isdigit(static_cast<unsigned char>(begin[1]))) {
+        begin++;
+    }
+    auto [pos, ec] = from_chars(begin, end, *i);
+    if (ec != errc()) {
+        ostringstream stringStream;
+        stringStream << s << " is not an integer.";
+        err = stringStream.str();
+        return false;
+    }
+    if (pos != end) {
+        ostringstream stringStream;
+        stringStream << "Illegal character \"" << *pos << "\" found.";
+        err = stringStream.str();
+        return false;
+    }
+
+    return true;
+}
+
+}
+
+}
@@ -22,8 +22,11 @@
 
 #include "adjacencyliststringreader.h"
 
+#include "adjacencylistparsing.h"
+#include "linetokenizer.h"
 #include "graph/digraph.h"
 
+#include <cstring>
 #include <vector>
 #include <stdexcept>
 #include <sstream>
@@ -38,10 +41,10 @@ public:
     explicit CheshireCat(AdjacencyListStringFormat &f) : format(f) { }
 };
 
-bool parseInt(std::string s, int *i, std::string &err);
+using AdjacencyListParsing::parseInt;
 
 AdjacencyListStringReader::AdjacencyListStringReader(std::istream *input, AdjacencyListStringFormat format)
-    : StreamDiGraphReader(input), grin(new CheshireCat(format))
+    : TextDiGraphReader(input, format.getVertexSeparator()), grin(new CheshireCat(format))
 {
 
 }
@@ -58,79 +61,87 @@ std::string AdjacencyListStringReader::getLastError() const
 
 bool AdjacencyListStringReader::provideDiGraph(DiGraph *graph)
 {
-    if (StreamDiGraphReader::inputStream == nullptr) {
+    if (!hasInput()) {
         return false;
     }
-    std::istream &inputStream = *(StreamDiGraphReader::inputStream);
     using namespace std;
     string token;
 
-    getline(inputStream, token, grin->format.getVertexSeparator());
+    // What follows the last adjacency list is handed back to the stream,
+    // just as getline would have left it there.
+    Lines input(*this);
+    LineTokenizer &lines = input.tokens;
 
-    if (!inputStream) {
+    if (!lines.nextLine()) {
+        input.fail();
         grin->lastError = "Failed to read number of vertices";
         return false;
     }
 
     int numVertices;
+    token.assign(lines.getLine(), lines.getLineEnd());
     if (!parseInt(token, &numVertices, grin->lastError)) {
         return false;
     }
 
     vector<Vertex*> vertices;
+    if (numVertices > 0) {
+        vertices.reserve(static_cast<size_t>(numVertices));
+    }
     for (int i = 0; i < numVertices; i++) {
         vertices.push_back(graph->addVertex());
     }
 
-    int currVertex = 0;
-    int adjVertex;
-    while (currVertex < numVertices
-           && getline(inputStream, token, grin->format.getVertexSeparator())) {
-
-        istringstream adjacencyStream(token);
+    // Arcs are collected first and added in bulk afterwards.
+    const char arcSeparator = grin->format.getArcSeparator();
+    const bool outgoing = grin->format.useOutgoingArcs();
+    vector<pair<int,int>> arcs;
 
-        while (getline(adjacencyStream, token, grin->format.getArcSeparator())) {
-            if (!parseInt(token, &adjVertex, grin->lastError)) {
-                return false;
-            }
-            if (adjVertex < 0 || adjVertex >= numVertices) {
-                ostringstream stringStream;
-                stringStream << "Illegal adjacency " << adjVertex << ".";
-                grin->lastError = stringStream.str();
+    auto addAdjacency = [&](int currVertex, const char *begin, const char *end) {
+        int adjVertex;
+        token.assign(begin, end);
+        if (!parseInt(token, &adjVertex, grin->lastError)) {
+            return false;
+        }
+        if (adjVertex < 0 || adjVertex >= numVertices) {
+            ostringstream stringStream;
+            stringStream << "Illegal adjacency " << adjVertex << ".";
+            grin->lastError = stringStream.str();
+            return false;
+        }
+        if (outgoing) {
+            arcs.emplace_back(currVertex, adjVertex);
+        } else {
+            arcs.emplace_back(adjVertex, currVertex);
+        }
+        return true;
+    };
+
+    for (int currVertex = 0; currVertex < numVertices; currVertex++) {
+        if (!lines.nextLine()) {
+            // no more adjacency lists
+            input.fail();
+            break;
+        }
+        const char *pos = lines.getLine();
+        const char *end = lines.getLineEnd();
+        while (pos != end) {
+            auto sep = static_cast<const char*>(memchr(pos, arcSeparator, static_cast<size_t>(end - pos)));
+            // like getline, ignore an empty token after the last separator
+            if (!addAdjacency(currVertex, pos, sep ? sep : end)) {
                 return false;
             }
-            if (grin->format.useOutgoingArcs()) {
-                graph->addArc(vertices.at(currVertex), vertices.at(adjVertex));
-            } else {
-                graph->addArc(vertices.at(adjVertex), vertices.at(currVertex));
-            }
+            pos = sep ? sep + 1 : end;
         }
-        currVertex++;
     }
-
-    return true;
-
-}
-
-bool parseInt(std::string s, int *i, std::string &err) {
-    using namespace std;
-    size_t pos;
-    try {
-        *i = stoi(s, &pos);
-    } catch (const logic_error &) {
-        ostringstream stringStream;
-        stringStream << s << " is not an integer.";
-        err = stringStream.str();
-        return false;
-    }
-    if (pos < s.length()) {
-        ostringstream stringStream;
-        stringStream << "Illegal character \"" << s.at(pos) << "\" found.";
-        err = stringStream.str();
-        return false;
+    graph->beginTransaction();
+    for (const auto &[tail, head] : arcs) {
+        graph->addArc(vertices[tail], vertices[head]);
     }
+    graph->commitTransaction();
 
     return true;
+
 }
 
 }
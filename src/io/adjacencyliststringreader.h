@@ -23,15 +23,15 @@
 #ifndef ADJACENCYLISTSTRINGREADER_H
 #define ADJACENCYLISTSTRINGREADER_H
 
-#include "streamdigraphreader.h"
+#include "textdigraphreader.h"
 #include "adjacencyliststringformat.h"
 
 namespace Algora {
 
-class AdjacencyListStringReader : public StreamDiGraphReader
+class AdjacencyListStringReader : public TextDiGraphReader
 {
 public:
-    AdjacencyListStringReader(std::istream *input,
+    AdjacencyListStringReader(std::istream *input = nullptr,
                               AdjacencyListStringFormat format = AdjacencyListStringFormat());
     virtual ~AdjacencyListStringReader() override;
 
@@ -25,8 +25,9 @@
 #include "graph/digraph.h"
 #include "graph/vertex.h"
 #include "graph/arc.h"
-#include "property/propertymap.h"
+#include "property/fastpropertymap.h"
 #include "pipe/digraphinfo.h"
+#include "outputbuffer.h"
 
 #include <vector>
 
@@ -58,7 +59,11 @@ void AdjacencyListStringWriter::processGraph(const DiGraph *graph, const DiGraph
     }
     std::ostream &outputStream = *(StreamDiGraphWriter::outputStream);
     DiGraph *ncGraph = const_cast<DiGraph*>(graph);
-    outputStream << ncGraph->getSize() << grin->format.getVertexSeparator();
+    OutputBuffer out(outputStream);
+    const char vertexSeparator = grin->format.getVertexSeparator();
+    const char arcSeparator = grin->format.getArcSeparator();
+    out.putNumber(ncGraph->getSize());
+    out.put(vertexSeparator);
 
     DiGraphInfo defaultInfo(ncGraph);
     if (!info) {
@@ -66,27 +71,31 @@ void AdjacencyListStringWriter::processGraph(const DiGraph *graph, const DiGraph
     }
 
     std::vector<Vertex*> vertices;
-    info->mapVertices([&](Vertex *v) { vertices.push_back(v); });
-    PropertyMap<int> vIndex(-1);
-    for (unsigned int i = 0; i < vertices.size(); i++) {
-        vIndex.setValue(vertices.at(i), i);
-    }
+    vertices.reserve(ncGraph->getSize());
+    FastPropertyMap<DiGraph::size_type> vIndex(0U);
+    info->mapVertices([&](Vertex *v) {
+        vIndex.setValue(v, vertices.size());
+        vertices.push_back(v);
+    });
 
     if (grin->format.useOutgoingArcs()) {
-        for (unsigned int v = 0; v < vertices.size(); v++) {
-            info->mapOutgoingArcs(vertices.at(v), [&](Arc *a) {
-                outputStream << vIndex.getValue(a->getHead()) << grin->format.getArcSeparator();
+        for (Vertex *v : vertices) {
+            info->mapOutgoingArcs(v, [&](Arc *a) {
+                out.putNumber(vIndex(a->getHead()));
+                out.put(arcSeparator);
             });
-            outputStream << grin->format.getVertexSeparator();
+            out.put(vertexSeparator);
         }
     } else {
-        for (unsigned int v = 0; v < vertices.size(); v++) {
-            info->mapIncomingArcs(vertices.at(v), [&](Arc *a) {
-                outputStream << vIndex.getValue(a->getTail()) << grin->format.getArcSeparator();
+        for (Vertex *v : vertices) {
+            info->mapIncomingArcs(v, [&](Arc *a) {
+                out.putNumber(vIndex(a->getTail()));
+                out.put(arcSeparator);
             });
-            outputStream << grin->format.getVertexSeparator();
+            out.put(vertexSeparator);
         }
     }
+    out.flush();
     outputStream.flush();
 }
 
@@ -24,6 +24,7 @@
 
 #include "graph/digraph.h"
 #include "property/propertymap.h"
+#include "property/fastpropertymap.h"
 #include "pipe/digraphinfo.h"
 
 #include <map>
@@ -45,18 +46,22 @@ struct AdjacencyMatrixRW::CheshireCat {
     bool oneLine;
     bool upperTriangularMatrix;
     bool includeDiagonal;
+    bool packed;
 
-    CheshireCat(bool oneLine, bool upper, bool diag)
+    CheshireCat(bool oneLine, bool upper, bool diag, bool packed)
         : oneLine(oneLine),
           upperTriangularMatrix(upper),
-          includeDiagonal(diag) { }
+          includeDiagonal(diag),
+          packed(packed) { }
 };
 
 bool readGraph(std::istream &is, DiGraph *graph);
 bool writeGraph(std::ostream &os, const DiGraph *graph, const DiGraphInfo *info, bool oneLine, bool upperTriangleOnly, bool includeDiagonal);
+bool readPackedRows(std::istream &is, DiGraph *graph, int n, bool upperTriangle, bool diagonal);
+bool writePackedGraph(std::ostream &os, const DiGraph *graph, const DiGraphInfo *info, bool upperTriangleOnly, bool includeDiagonal);
 
-AdjacencyMatrixRW::AdjacencyMatrixRW(bool oneLine, bool upperTriangleOnly, bool withDiagonal)
-    : grin(new CheshireCat(oneLine, upperTriangleOnly, withDiagonal))
+AdjacencyMatrixRW::AdjacencyMatrixRW(bool oneLine, bool upperTriangleOnly, bool withDiagonal, bool packed)
+    : grin(new CheshireCat(oneLine, upperTriangleOnly, withDiagonal, packed))
 {
 
 }
@@ -81,6 +86,11 @@ void AdjacencyMatrixRW::writeWithDiagonal(bool diagonal)
     grin->includeDiagonal = diagonal;
 }
 
+void AdjacencyMatrixRW::writePacked(bool packed)
+{
+    grin->packed = packed;
+}
+
 bool AdjacencyMatrixRW::oneLine() const
 {
     return grin->oneLine;
@@ -96,6 +106,11 @@ bool AdjacencyMatrixRW::withDiagonal() const
     return grin->includeDiagonal;
 }
 
+bool AdjacencyMatrixRW::packed() const
+{
+    return grin->packed;
+}
+
 void AdjacencyMatrixRW::processGraph(const DiGraph *graph, const DiGraphInfo *info)
 {
     if (StreamDiGraphWriter::outputStream == 0) {
@@ -104,7 +119,11 @@ void AdjacencyMatrixRW::processGraph(const DiGraph *graph, const DiGraphInfo *in
 
     std::ostream &outputStream = *(StreamDiGraphWriter::outputStream);
 
-    writeGraph(outputStream, graph, info, grin->oneLine, grin->upperTriangularMatrix, grin->includeDiagonal);
+    if (grin->packed) {
+        writePackedGraph(outputStream, graph, info, grin->upperTriangularMatrix, grin->includeDiagonal);
+    } else {
+        writeGraph(outputStream, graph, info, grin->oneLine, grin->upperTriangularMatrix, grin->includeDiagonal);
+    }
 }
 
 bool AdjacencyMatrixRW::provideDiGraph(DiGraph *graph)
@@ -123,6 +142,7 @@ bool readGraph(std::istream &is, DiGraph *graph) {
     bool oneLine = false;
     bool upperTriangle = false;
     bool diagonal = false;
+    bool packed = false;
 
     if (!(is >> n)) {
         std::cerr << "io: Could not read n." << std::endl;
@@ -157,6 +177,9 @@ bool readGraph(std::istream &is, DiGraph *graph) {
             case 'd':
                 diagonal = true;
                 break;
+            case 'b':
+                packed = true;
+                break;
             default:
                 std::cerr << "io: Unsupported option " << c << "." << std::endl;
                 return false;
@@ -175,6 +198,13 @@ bool readGraph(std::istream &is, DiGraph *graph) {
             std::cerr << "io: Missing second ':'." << std::endl;
             return false;
         }
+        if (packed) {
+            if (is.get() != '\n') {
+                std::cerr << "io: Missing newline after header." << std::endl;
+                return false;
+            }
+            return readPackedRows(is, graph, n, upperTriangle, diagonal);
+        }
     }
     std::vector<Vertex*> vertices;
     for (int i = 0; i < n; i++) {
@@ -313,4 +343,100 @@ bool writeGraph(std::ostream &os, const DiGraph *graph, const DiGraphInfo *info,
     return true;
 }
 
+bool readPackedRows(std::istream &is, DiGraph *graph, int n, bool upperTriangle, bool diagonal)
+{
+    std::vector<Vertex*> vertices;
+    vertices.reserve(n);
+    for (int i = 0; i < n; i++) {
+        vertices.push_back(graph->addVertex());
+    }
+
+    bool ok = true;
+    std::vector<unsigned char> row(static_cast<std::size_t>(n + 7) / 8U);
+    graph->beginTransaction();
+    for (int i = 0; i < n; i++) {
+        int jStart = upperTriangle ? (diagonal ? i : i + 1) : 0;
+        int bytes = (n - jStart + 7) / 8;
+        if (bytes == 0) {
+            continue;
+        }
+        if (!is.read(reinterpret_cast<char*>(row.data()), bytes)) {
+            std::cerr << "io: Could not read row #" << i << "." << std::endl;
+            ok = false;
+            break;
+        }
+        // bits beyond column n - 1 must be zero
+        unsigned int padding = 0xFFU >> (n - jStart - 8 * (bytes - 1));
+        if (row[bytes - 1] & padding) {
+            std::cerr << "io: Nonzero padding in row #" << i << "." << std::endl;
+            ok = false;
+            break;
+        }
+        for (int b = 0; b < bytes; b++) {
+            unsigned int value = row[b];
+            for (int j = jStart + 8 * b; value != 0U && j < n; j++, value = (value << 1) & 0xFFU) {
+                if (value & 0x80U) {
+                    graph->addArc(vertices[i], vertices[j]);
+                }
+            }
+        }
+    }
+    graph->commitTransaction();
+    return ok;
+}
+
+bool writePackedGraph(std::ostream &os, const DiGraph *graph, const DiGraphInfo *info, bool upperTriangleOnly, bool includeDiagonal)
+{
+    DiGraph *ncGraph = const_cast<DiGraph*>(graph);
+    int n = ncGraph->getSize();
+    DiGraphInfo defaultInfo(ncGraph);
+    if (!info) {
+        info = &defaultInfo;
+    }
+    includeDiagonal = includeDiagonal && upperTriangleOnly;
+
+    FastPropertyMap<int> vertexId(-1);
+    std::vector<Vertex*> vertices;
+    vertices.reserve(n);
+    info->mapVertices([&](Vertex *v) {
+        vertexId[v] = vertices.size();
+        vertices.push_back(v);
+    });
+    if (upperTriangleOnly && !includeDiagonal) {
+        bool loop = false;
+        info->mapArcsUntil([&](Arc *a) { loop = a->isLoop(); }, [&](const Arc *) { return loop; });
+        if (loop) {
+            return false;
+        }
+    }
+
+    os << n << " : b ";
+    if (upperTriangleOnly) {
+        os << "u ";
+    }
+    if (includeDiagonal) {
+        os << "d ";
+    }
+    os << ":\n";
+
+    std::vector<char> row(static_cast<std::size_t>(n + 7) / 8U);
+    for (int i = 0; i < n; i++) {
+        int jStart = upperTriangleOnly ? (includeDiagonal ? i : i + 1) : 0;
+        int bytes = (n - jStart + 7) / 8;
+        std::fill(row.begin(), row.begin() + bytes, 0);
+        auto set = [&](int j) {
+            if (j >= jStart) {
+                j -= jStart;
+                row[j / 8] |= static_cast<char>(0x80U >> (j % 8));
+            }
+        };
+        info->mapOutgoingArcs(vertices[i], [&](Arc *a) { set(vertexId(a->getHead())); });
+        if (upperTriangleOnly) {
+            info->mapIncomingArcs(vertices[i], [&](Arc *a) { set(vertexId(a->getTail())); });
+        }
+        os.write(row.data(), bytes);
+    }
+    return true;
+}
+
 }
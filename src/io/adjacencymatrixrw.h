@@ -28,19 +28,27 @@
 
 namespace Algora {
 
+// In packed mode, the one-line header carries the option 'b' and is followed
+// by a newline and the matrix as raw bits, one per entry, row by row.
+// Each row starts at a new byte; bits are stored most significant first.
+// Packed matrices store neither arc multiplicities nor, if only the upper
+// triangle is written, directions; streams must be opened in binary mode.
 class AdjacencyMatrixRW : public StreamDiGraphReader, public StreamDiGraphWriter
 {
 public:
-    AdjacencyMatrixRW(bool oneLine = false, bool upperTriangleOnly = false, bool withDiagonal = false);
+    AdjacencyMatrixRW(bool oneLine = false, bool upperTriangleOnly = false, bool withDiagonal = false,
+                      bool packed = false);
     virtual ~AdjacencyMatrixRW();
 
     void useOneLineFormat(bool oneLine);
     void writeUpperTriangleOnly(bool upper);
     void writeWithDiagonal(bool diagonal);
+    void writePacked(bool packed);
 
     bool oneLine() const;
     bool upperTriangleOnly() const;
     bool withDiagonal() const;
+    bool packed() const;
 
     // DiGraphProcessor interface
 public:
@@ -0,0 +1,125 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef BINARYGRAPHFORMAT_H
+#define BINARYGRAPHFORMAT_H
+
+#include <cstdint>
+#include <cstring>
+
+namespace Algora {
+
+// Layout of the native binary graph format, version 1.
+//
+// All numbers are stored in native (little-endian) byte order; every section
+// starts at a multiple of 8 bytes:
+//   Header
+//   out offsets    (numVertices + 1) x uint64
+//   out targets    numArcs x index type, zero-padded to 8 bytes
+//   arc ids        numArcs x uint64                     [HasArcIds]
+//   arc weights    numArcs x double                     [HasArcWeights]
+//   in offsets     (numVertices + 1) x uint64           [HasIncomingIndex]
+//   in sources     numArcs x index type, padded         [HasIncomingIndex]
+//   in arc indices numArcs x uint64                     [HasIncomingIndex]
+//   checksum       uint64 over all preceding bytes
+// The index type is uint32, or uint64 if WideIndices is set.
+// Arcs are numbered by their position in the out targets array.
+namespace BinaryGraphFormat {
+
+const char MAGIC[8] = { 'A', 'L', 'G', 'O', 'R', 'A', 'G', 'B' };
+const std::uint32_t VERSION = 1U;
+
+enum Flags : std::uint32_t {
+    HasArcIds = 1U,
+    HasArcWeights = 2U,
+    HasIncomingIndex = 4U,
+    WideIndices = 8U
+};
+
+struct Header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t flags;
+    std::uint64_t numVertices;
+    std::uint64_t numArcs;
+};
+static_assert(sizeof(Header) == 32U, "Unexpected header size.");
+
+inline std::uint64_t paddedSize(std::uint64_t bytes) {
+    return (bytes + 7U) & ~std::uint64_t(7U);
+}
+
+inline std::uint64_t indexSize(std::uint32_t flags) {
+    return (flags & WideIndices) ? 8U : 4U;
+}
+
+// upper bound on vertex and arc counts, so that the sizes computed
+// below cannot overflow
+const std::uint64_t MAX_COUNT = std::uint64_t(1U) << 58U;
+
+inline bool hasValidCounts(const Header &h) {
+    return h.numVertices < MAX_COUNT && h.numArcs < MAX_COUNT;
+}
+
+// total size of a file with the given header, which must have valid counts
+inline std::uint64_t fileSize(const Header &h) {
+    std::uint64_t offsets = (h.numVertices + 1U) * 8U;
+    std::uint64_t indices = paddedSize(h.numArcs * indexSize(h.flags));
+    std::uint64_t size = sizeof(Header) + offsets + indices;
+    if (h.flags & HasArcIds) {
+        size += h.numArcs * 8U;
+    }
+    if (h.flags & HasArcWeights) {
+        size += h.numArcs * 8U;
+    }
+    if (h.flags & HasIncomingIndex) {
+        size += offsets + indices + h.numArcs * 8U;
+    }
+    return size + 8U;
+}
+
+// word-wise checksum, cheap enough to be computed while streaming
+class Checksum {
+public:
+    Checksum() : state(0x9E3779B97F4A7C15ULL) { }
+
+    void add(const void *data, std::uint64_t numWords) {
+        const char *bytes = static_cast<const char*>(data);
+        for (std::uint64_t i = 0U; i < numWords; i++) {
+            std::uint64_t word;
+            std::memcpy(&word, bytes + 8U * i, 8U);
+            state = (state ^ word) * 0x100000001B3ULL;
+            state ^= state >> 29;
+        }
+    }
+
+    std::uint64_t get() const { return state; }
+
+private:
+    std::uint64_t state;
+};
+
+}
+
+}
+
+#endif // BINARYGRAPHFORMAT_H
@@ -0,0 +1,489 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "binarygraphrw.h"
+#include "binarygraphformat.h"
+#include "bulkgraphbuilder.h"
+
+#include "graph/digraph.h"
+#include "property/fastpropertymap.h"
+
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+
+namespace Algora {
+
+using namespace BinaryGraphFormat;
+
+// buffers output and keeps the checksum up to date
+class ChecksumWriter {
+public:
+    explicit ChecksumWriter(std::ostream &os) : os(os) {
+        buffer.reserve(BUFFER_SIZE);
+    }
+    ~ChecksumWriter() {
+        flush();
+    }
+
+    template<typename T>
+    void put(T value) {
+        const char *bytes = reinterpret_cast<const char*>(&value);
+        buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        if (buffer.size() >= BUFFER_SIZE) {
+            flush();
+        }
+    }
+
+    void putIndex(std::uint64_t value, bool wide) {
+        if (wide) {
+            put<std::uint64_t>(value);
+        } else {
+            put<std::uint32_t>(static_cast<std::uint32_t>(value));
+        }
+    }
+
+    void pad() {
+        while ((written + buffer.size()) % 8U != 0U) {
+            buffer.push_back(0);
+        }
+    }
+
+    void putChecksum() {
+        pad();
+        flush();
+        std::uint64_t sum = checksum.get();
+        os.write(reinterpret_cast<const char*>(&sum), sizeof(sum));
+    }
+
+private:
+    static const std::size_t BUFFER_SIZE = 1U << 20;
+    std::ostream &os;
+    std::vector<char> buffer;
+    std::uint64_t written = 0U;
+    Checksum checksum;
+
+    void flush() {
+        // only whole words are added to the checksum
+        auto words = buffer.size() / 8U;
+        checksum.add(buffer.data(), words);
+        os.write(buffer.data(), static_cast<std::streamsize>(words * 8U));
+        written += words * 8U;
+        buffer.erase(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(words * 8U));
+    }
+};
+
+// reads sections and keeps the checksum up to date
+class ChecksumReader {
+public:
+    explicit ChecksumReader(std::istream &is) : is(is) { }
+
+    // grows values along with the input read, so that a corrupt count
+    // cannot cause a huge allocation
+    template<typename T>
+    bool read(std::vector<T> &values, std::uint64_t count) {
+        values.clear();
+        while (values.size() < count) {
+            auto begin = values.size();
+            auto chunk = std::min<std::uint64_t>(count - begin, CHUNK_SIZE);
+            values.resize(begin + chunk);
+            if (!readBytes(values.data() + begin, chunk * sizeof(T))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool readBytes(void *data, std::uint64_t bytes) {
+        std::uint64_t padded = paddedSize(bytes);
+        if (padded != bytes) {
+            std::vector<char> tmp(padded);
+            if (!is.read(tmp.data(), static_cast<std::streamsize>(padded))) {
+                return false;
+            }
+            checksum.add(tmp.data(), padded / 8U);
+            std::memcpy(data, tmp.data(), bytes);
+            return true;
+        }
+        if (!is.read(static_cast<char*>(data), static_cast<std::streamsize>(bytes))) {
+            return false;
+        }
+        checksum.add(data, bytes / 8U);
+        return true;
+    }
+
+    std::uint64_t getChecksum() const { return checksum.get(); }
+
+    // bytes left in the stream, or the maximum if the stream cannot tell
+    std::uint64_t available() const {
+        std::streambuf *buffer = is.rdbuf();
+        auto pos = buffer->pubseekoff(0, std::ios_base::cur, std::ios_base::in);
+        if (pos == std::streampos(-1)) {
+            return std::numeric_limits<std::uint64_t>::max();
+        }
+        auto end = buffer->pubseekoff(0, std::ios_base::end, std::ios_base::in);
+        buffer->pubseekpos(pos, std::ios_base::in);
+        if (end == std::streampos(-1) || end < pos) {
+            return std::numeric_limits<std::uint64_t>::max();
+        }
+        return static_cast<std::uint64_t>(end - pos);
+    }
+
+private:
+    // elements per read, a multiple of 8 so that chunks need no padding
+    static constexpr std::uint64_t CHUNK_SIZE = 1U << 20;
+    std::istream &is;
+    Checksum checksum;
+};
+
+class BinaryGraphRW::CheshireCat {
+public:
+    bool arcIds;
+    bool incomingIndex;
+    ModifiableProperty<double> *weights;
+    std::string lastError;
+
+    CheshireCat(bool ids, bool incoming) : arcIds(ids), incomingIndex(incoming), weights(nullptr) { }
+
+    bool fail(const std::string &error) {
+        lastError = error;
+        return false;
+    }
+
+    template<typename T>
+    bool readIndices(ChecksumReader &reader, std::vector<T> &indices, std::uint64_t numArcs,
+                     std::uint64_t numVertices) {
+        if (!reader.read(indices, numArcs)) {
+            return false;
+        }
+        for (const auto &i : indices) {
+            if (i >= numVertices) {
+                return fail("Illegal vertex index.");
+            }
+        }
+        return true;
+    }
+
+    template<typename T>
+    bool readGraph(ChecksumReader &reader, const Header &header, DiGraph *graph);
+};
+
+BinaryGraphRW::BinaryGraphRW(bool writeArcIds, bool writeIncomingIndex)
+    : grin(new CheshireCat(writeArcIds, writeIncomingIndex))
+{
+
+}
+
+BinaryGraphRW::~BinaryGraphRW()
+{
+    delete grin;
+}
+
+void BinaryGraphRW::setWriteArcIds(bool arcIds)
+{
+    grin->arcIds = arcIds;
+}
+
+void BinaryGraphRW::setWriteIncomingIndex(bool incomingIndex)
+{
+    grin->incomingIndex = incomingIndex;
+}
+
+void BinaryGraphRW::useArcWeights(ModifiableProperty<double> *weights)
+{
+    grin->weights = weights;
+}
+
+std::string BinaryGraphRW::getLastError() const
+{
+    return grin->lastError;
+}
+
+void BinaryGraphRW::processGraph(const DiGraph *graph, const DiGraphInfo *)
+{
+    if (StreamDiGraphWriter::outputStream == nullptr) {
+        return;
+    }
+    DiGraph *g = const_cast<DiGraph*>(graph);
+
+    std::uint64_t n = g->getSize();
+    std::uint64_t m = g->getNumArcs(true);
+    Header header;
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.flags = 0U;
+    if (grin->arcIds) {
+        header.flags |= HasArcIds;
+    }
+    if (grin->weights) {
+        header.flags |= HasArcWeights;
+    }
+    if (grin->incomingIndex) {
+        header.flags |= HasIncomingIndex;
+    }
+    bool wide = n > UINT32_MAX;
+    if (wide) {
+        header.flags |= WideIndices;
+    }
+    header.numVertices = n;
+    header.numArcs = m;
+
+    FastPropertyMap<std::uint64_t> vertexIndex(0U);
+    std::vector<Vertex*> vertices;
+    vertices.reserve(n);
+    g->mapVertices([&](Vertex *v) {
+        vertexIndex.setValue(v, vertices.size());
+        vertices.push_back(v);
+    });
+
+    ChecksumWriter out(*(StreamDiGraphWriter::outputStream));
+    out.put(header);
+
+    std::uint64_t offset = 0U;
+    out.put(offset);
+    for (Vertex *v : vertices) {
+        offset += g->getOutDegree(v, true);
+        out.put(offset);
+    }
+    FastPropertyMap<std::uint64_t> arcIndex(0U);
+    std::vector<Arc*> arcs;
+    arcs.reserve(m);
+    for (Vertex *v : vertices) {
+        g->mapOutgoingArcs(v, [&](Arc *a) {
+            arcIndex.setValue(a, arcs.size());
+            arcs.push_back(a);
+            out.putIndex(vertexIndex(a->getHead()), wide);
+        });
+    }
+    out.pad();
+    if (grin->arcIds) {
+        for (Arc *a : arcs) {
+            out.put<std::uint64_t>(a->getId());
+        }
+    }
+    if (grin->weights) {
+        for (Arc *a : arcs) {
+            out.put<double>(grin->weights->getValue(a));
+        }
+    }
+    if (grin->incomingIndex) {
+        offset = 0U;
+        out.put(offset);
+        for (Vertex *v : vertices) {
+            offset += g->getInDegree(v, true);
+            out.put(offset);
+        }
+        for (Vertex *v : vertices) {
+            g->mapIncomingArcs(v, [&](Arc *a) {
+                out.putIndex(vertexIndex(a->getTail()), wide);
+            });
+        }
+        out.pad();
+        for (Vertex *v : vertices) {
+            g->mapIncomingArcs(v, [&](Arc *a) {
+                out.put<std::uint64_t>(arcIndex(a));
+            });
+        }
+    }
+    out.putChecksum();
+}
+
+void BinaryGraphRW::writeArcs(std::uint64_t numVertices,
+                              const std::vector<std::pair<std::uint64_t, std::uint64_t>> &arcs)
+{
+    if (StreamDiGraphWriter::outputStream == nullptr) {
+        return;
+    }
+    std::uint64_t n = numVertices;
+    std::uint64_t m = arcs.size();
+    Header header;
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.flags = 0U;
+    if (grin->arcIds) {
+        header.flags |= HasArcIds;
+    }
+    if (grin->incomingIndex) {
+        header.flags |= HasIncomingIndex;
+    }
+    bool wide = n > UINT32_MAX;
+    if (wide) {
+        header.flags |= WideIndices;
+    }
+    header.numVertices = n;
+    header.numArcs = m;
+
+    // counting sort by tail: order[i] is the list position of the i-th arc
+    std::vector<std::uint64_t> offsets(n + 1U, 0U);
+    for (const auto &a : arcs) {
+        if (a.first >= n || a.second >= n) {
+            throw std::invalid_argument("Vertex index out of range.");
+        }
+        offsets[a.first + 1U]++;
+    }
+    for (std::uint64_t v = 0U; v < n; v++) {
+        offsets[v + 1U] += offsets[v];
+    }
+    std::vector<std::uint64_t> order(m);
+    {
+        std::vector<std::uint64_t> next(offsets.begin(), offsets.end() - 1);
+        for (std::uint64_t i = 0U; i < m; i++) {
+            order[next[arcs[i].first]++] = i;
+        }
+    }
+
+    ChecksumWriter out(*(StreamDiGraphWriter::outputStream));
+    out.put(header);
+    for (const auto &o : offsets) {
+        out.put(o);
+    }
+    for (const auto &i : order) {
+        out.putIndex(arcs[i].second, wide);
+    }
+    out.pad();
+    if (grin->arcIds) {
+        for (const auto &i : order) {
+            out.put<std::uint64_t>(i);
+        }
+    }
+    if (grin->incomingIndex) {
+        std::fill(offsets.begin(), offsets.end(), 0U);
+        for (const auto &a : arcs) {
+            offsets[a.second + 1U]++;
+        }
+        for (std::uint64_t v = 0U; v < n; v++) {
+            offsets[v + 1U] += offsets[v];
+        }
+        // incoming[j] is the out position of the j-th incoming arc
+        std::vector<std::uint64_t> incoming(m);
+        std::vector<std::uint64_t> next(offsets.begin(), offsets.end() - 1);
+        for (std::uint64_t pos = 0U; pos < m; pos++) {
+            incoming[next[arcs[order[pos]].second]++] = pos;
+        }
+        for (const auto &o : offsets) {
+            out.put(o);
+        }
+        for (const auto &pos : incoming) {
+            out.putIndex(arcs[order[pos]].first, wide);
+        }
+        out.pad();
+        for (const auto &pos : incoming) {
+            out.put<std::uint64_t>(pos);
+        }
+    }
+    out.putChecksum();
+}
+
+bool BinaryGraphRW::provideDiGraph(DiGraph *graph)
+{
+    if (StreamDiGraphReader::inputStream == nullptr) {
+        return false;
+    }
+    ChecksumReader reader(*(StreamDiGraphReader::inputStream));
+    Header header;
+    if (!reader.readBytes(&header, sizeof(header))) {
+        return grin->fail("Failed to read header.");
+    }
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        return grin->fail("Not a binary graph file.");
+    }
+    if (header.version != VERSION) {
+        return grin->fail("Unsupported format version " + std::to_string(header.version) + ".");
+    }
+    if (!hasValidCounts(header) || fileSize(header) - sizeof(Header) > reader.available()) {
+        return grin->fail("Unexpected file size.");
+    }
+    if (header.flags & WideIndices) {
+        return grin->readGraph<std::uint64_t>(reader, header, graph);
+    }
+    return grin->readGraph<std::uint32_t>(reader, header, graph);
+}
+
+template<typename T>
+bool BinaryGraphRW::CheshireCat::readGraph(ChecksumReader &reader, const Header &header, DiGraph *graph)
+{
+    auto n = header.numVertices;
+    auto m = header.numArcs;
+    std::vector<std::uint64_t> offsets;
+    std::vector<T> targets;
+    std::vector<std::uint64_t> ids;
+    std::vector<double> arcWeights;
+    if (!reader.read(offsets, n + 1U) || !readIndices(reader, targets, m, n)) {
+        return fail("Failed to read arcs.");
+    }
+    if (offsets.front() != 0U || offsets.back() != m || !std::is_sorted(offsets.begin(), offsets.end())) {
+        return fail("Illegal offsets.");
+    }
+    if ((header.flags & HasArcIds) && !reader.read(ids, m)) {
+        return fail("Failed to read arc ids.");
+    }
+    if ((header.flags & HasArcWeights) && !reader.read(arcWeights, m)) {
+        return fail("Failed to read arc weights.");
+    }
+    if (header.flags & HasIncomingIndex) {
+        // not needed here
+        std::vector<std::uint64_t> tmp;
+        std::vector<T> sources;
+        if (!reader.read(tmp, n + 1U) || !reader.read(sources, m) || !reader.read(tmp, m)) {
+            return fail("Failed to read incoming index.");
+        }
+    }
+    std::uint64_t expected = reader.getChecksum();
+    std::uint64_t checksum;
+    if (!reader.readBytes(&checksum, sizeof(checksum))) {
+        return fail("Failed to read checksum.");
+    }
+    if (checksum != expected) {
+        return fail("Checksum mismatch.");
+    }
+
+    const bool arcWeightsRead = !arcWeights.empty();
+    BulkGraphBuilder builder;
+    builder.setNumVertices(n);
+    builder.reserve(m);
+    try {
+        for (std::uint64_t v = 0U; v < n; v++) {
+            for (auto k = offsets[v]; k < offsets[v + 1U]; k++) {
+                if (arcWeightsRead) {
+                    builder.addArc(v, targets[k], arcWeights[k]);
+                } else {
+                    builder.addArc(v, targets[k]);
+                }
+            }
+        }
+    } catch (const std::length_error &) {
+        return fail("Not enough memory for the graph.");
+    } catch (const std::bad_alloc &) {
+        return fail("Not enough memory for the graph.");
+    }
+    std::vector<T>().swap(targets);
+    std::vector<double>().swap(arcWeights);
+    if (!builder.build(graph, arcWeightsRead ? weights : nullptr)) {
+        return fail("Not enough memory for the graph.");
+    }
+    return true;
+}
+
+}
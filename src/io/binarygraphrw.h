@@ -0,0 +1,77 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef BINARYGRAPHRW_H
+#define BINARYGRAPHRW_H
+
+#include "streamdigraphreader.h"
+#include "streamdigraphwriter.h"
+#include "property/modifiableproperty.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Algora {
+
+// Reads and writes graphs in the native binary format, see
+// binarygraphformat.h. Streams must be opened in binary mode.
+// Vertices are numbered in the order of mapVertices(); multiarcs are
+// written as single arcs. To serve a file as a graph without reading it,
+// use CSRGraph.
+class BinaryGraphRW : public StreamDiGraphReader, public StreamDiGraphWriter
+{
+public:
+    explicit BinaryGraphRW(bool writeArcIds = false, bool writeIncomingIndex = true);
+    virtual ~BinaryGraphRW() override;
+
+    void setWriteArcIds(bool arcIds);
+    void setWriteIncomingIndex(bool incomingIndex);
+    // weights are written from and read into this property, if set
+    void useArcWeights(ModifiableProperty<double> *weights);
+
+    std::string getLastError() const;
+
+    // writes a graph given as list of (tail, head) vertex indices without
+    // building it; throws std::invalid_argument if an index is not smaller
+    // than numVertices. Arcs keep their relative order per tail, arc ids are
+    // list positions, weights are not written.
+    void writeArcs(std::uint64_t numVertices,
+                   const std::vector<std::pair<std::uint64_t, std::uint64_t>> &arcs);
+
+    // DiGraphProcessor interface
+public:
+    virtual void processGraph(const DiGraph *graph, const DiGraphInfo *info = nullptr) override;
+
+    // DiGraphProvider interface
+public:
+    virtual bool provideDiGraph(DiGraph *graph) override;
+
+private:
+    class CheshireCat;
+    CheshireCat *grin;
+};
+
+}
+
+#endif // BINARYGRAPHRW_H
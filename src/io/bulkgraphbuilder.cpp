@@ -0,0 +1,118 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "bulkgraphbuilder.h"
+
+#include "graph/digraph.h"
+#include "graph.incidencelist/incidencelistgraph.h"
+
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+
+namespace Algora {
+
+void BulkGraphBuilder::clear()
+{
+    numVertices = 0U;
+    arcs.clear();
+    weights.clear();
+    vertices.clear();
+}
+
+void BulkGraphBuilder::reserve(id_type numArcs)
+{
+    try {
+        arcs.reserve(numArcs);
+    } catch (const std::length_error &) {
+    } catch (const std::bad_alloc &) {
+    }
+}
+
+bool BulkGraphBuilder::build(DiGraph *graph, ModifiableProperty<double> *weightProperty,
+                             ModifiableProperty<unsigned long long> *idProperty)
+{
+    try {
+        buildUnchecked(graph, weightProperty, idProperty);
+    } catch (const std::length_error &) {
+        return false;
+    } catch (const std::bad_alloc &) {
+        return false;
+    }
+    return true;
+}
+
+void BulkGraphBuilder::buildUnchecked(DiGraph *graph, ModifiableProperty<double> *weightProperty,
+                                      ModifiableProperty<unsigned long long> *idProperty)
+{
+    std::vector<id_type> ids;
+    if (sparseIds) {
+        ids.reserve(2U * arcs.size());
+        for (const auto &a : arcs) {
+            ids.push_back(a.first);
+            ids.push_back(a.second);
+        }
+        std::sort(ids.begin(), ids.end());
+        ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+        auto index = [&ids](id_type id) {
+            return static_cast<id_type>(std::lower_bound(ids.begin(), ids.end(), id) - ids.begin());
+        };
+        for (auto &a : arcs) {
+            a.first = index(a.first);
+            a.second = index(a.second);
+        }
+        numVertices = ids.size();
+    }
+
+    vertices.clear();
+    vertices.reserve(numVertices);
+    if (auto incidenceListGraph = dynamic_cast<IncidenceListGraph*>(graph)) {
+        // allocate all vertex and arc objects in one go
+        incidenceListGraph->reserveVertexCapacity(incidenceListGraph->getSize() + numVertices);
+        incidenceListGraph->reserveArcCapacity(incidenceListGraph->getNumArcs(false) + arcs.size());
+    }
+
+    // vertices and arcs are delivered as one batch; if memory runs out,
+    // observers still learn about what has been added so far
+    graph->beginTransaction();
+    try {
+        for (id_type i = 0U; i < numVertices; i++) {
+            Vertex *v = graph->addVertex();
+            vertices.push_back(v);
+            if (idProperty) {
+                idProperty->setValue(v, sparseIds ? ids[i] : i);
+            }
+        }
+        for (std::size_t i = 0U; i < arcs.size(); i++) {
+            Arc *a = graph->addArc(vertices[arcs[i].first], vertices[arcs[i].second]);
+            if (weightProperty) {
+                weightProperty->setValue(a, i < weights.size() ? weights[i] : 1.0);
+            }
+        }
+    } catch (...) {
+        graph->commitTransaction();
+        throw;
+    }
+    graph->commitTransaction();
+}
+
+}
@@ -0,0 +1,94 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef BULKGRAPHBUILDER_H
+#define BULKGRAPHBUILDER_H
+
+#include "property/modifiableproperty.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace Algora {
+
+class DiGraph;
+class Vertex;
+
+// Collects arcs given by vertex ids and adds them to a graph in one
+// transaction. With dense ids, vertex i of the graph gets id i, ids must be
+// smaller than the number of vertices. With sparse ids, only ids that occur
+// get a vertex, numbered in increasing order of their ids.
+class BulkGraphBuilder
+{
+public:
+    typedef std::uint64_t id_type;
+    typedef std::vector<std::pair<id_type, id_type>> ArcList;
+
+    explicit BulkGraphBuilder(bool sparseIds = false)
+        : sparseIds(sparseIds), numVertices(0U) { }
+
+    void clear();
+    void setSparseIds(bool sparse) { sparseIds = sparse; }
+    // dense ids only
+    void setNumVertices(id_type n) { numVertices = n; }
+    id_type getNumVertices() const { return numVertices; }
+    id_type getNumArcs() const { return arcs.size(); }
+    // only a hint, failures to allocate are ignored
+    void reserve(id_type numArcs);
+
+    void addArc(id_type tail, id_type head) {
+        arcs.emplace_back(tail, head);
+    }
+    void addArc(id_type tail, id_type head, double weight) {
+        arcs.emplace_back(tail, head);
+        weights.resize(arcs.size() - 1U, 1.0);
+        weights.push_back(weight);
+    }
+
+    // replaces all arcs and weights
+    void setArcs(ArcList &&arcList) {
+        arcs = std::move(arcList);
+        weights.clear();
+    }
+
+    // arcs without explicit weight get weight 1; weightProperty and idProperty
+    // may be null
+    // Returns false if memory ran out, graph may then hold some of the vertices.
+    bool build(DiGraph *graph, ModifiableProperty<double> *weightProperty = nullptr,
+               ModifiableProperty<unsigned long long> *idProperty = nullptr);
+
+    const std::vector<Vertex*> &getVertices() const { return vertices; }
+
+private:
+    bool sparseIds;
+    id_type numVertices;
+    ArcList arcs;
+    std::vector<double> weights;
+    std::vector<Vertex*> vertices;
+
+    void buildUnchecked(DiGraph *graph, ModifiableProperty<double> *weightProperty,
+                        ModifiableProperty<unsigned long long> *idProperty);
+};
+
+}
+
+#endif // BULKGRAPHBUILDER_H
@@ -0,0 +1,188 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "dimacsgraphrw.h"
+
+#include "linetokenizer.h"
+#include "bulkgraphbuilder.h"
+#include "outputbuffer.h"
+#include "graph/digraph.h"
+#include "property/fastpropertymap.h"
+#include "pipe/digraphinfo.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace Algora {
+
+class DimacsGraphRW::CheshireCat {
+public:
+    ModifiableProperty<double> *weights;
+    std::string lastError;
+
+    CheshireCat() : weights(nullptr) { }
+
+    bool fail(const LineTokenizer &tokens, const std::string &error) {
+        lastError = "Line " + std::to_string(tokens.getLineNumber()) + ": " + error;
+        return false;
+    }
+};
+
+DimacsGraphRW::DimacsGraphRW()
+    : grin(new CheshireCat)
+{
+
+}
+
+DimacsGraphRW::~DimacsGraphRW()
+{
+    delete grin;
+}
+
+void DimacsGraphRW::useArcWeights(ModifiableProperty<double> *weights)
+{
+    grin->weights = weights;
+}
+
+std::string DimacsGraphRW::getLastError() const
+{
+    return grin->lastError;
+}
+
+void DimacsGraphRW::processGraph(const DiGraph *graph, const DiGraphInfo *info)
+{
+    if (StreamDiGraphWriter::outputStream == nullptr) {
+        return;
+    }
+    DiGraph *ncGraph = const_cast<DiGraph*>(graph);
+    DiGraphInfo defaultInfo(ncGraph);
+    if (!info) {
+        info = &defaultInfo;
+    }
+    std::vector<Vertex*> vertices;
+    FastPropertyMap<unsigned long long> index(0U);
+    info->mapVertices([&](Vertex *v) {
+        index.setValue(v, vertices.size());
+        vertices.push_back(v);
+    });
+
+    // a filtering info may hide arcs, so count those that are written
+    DiGraph::size_type numArcs = 0U;
+    if (info == &defaultInfo) {
+        numArcs = ncGraph->getNumArcs(true);
+    } else {
+        for (Vertex *v : vertices) {
+            info->mapOutgoingArcs(v, [&numArcs](Arc *) { numArcs++; });
+        }
+    }
+
+    OutputBuffer out(*(StreamDiGraphWriter::outputStream));
+    out.put("p sp ");
+    out.putNumber(vertices.size());
+    out.put(' ');
+    out.putNumber(numArcs);
+    out.put('\n');
+    for (Vertex *v : vertices) {
+        auto tail = index(v) + 1U;
+        info->mapOutgoingArcs(v, [&](Arc *a) {
+            out.put("a ");
+            out.putNumber(tail);
+            out.put(' ');
+            out.putNumber(index(a->getHead()) + 1U);
+            out.put(' ');
+            out.putNumber(grin->weights ? std::llround(grin->weights->getValue(a)) : 1LL);
+            out.put('\n');
+        });
+    }
+}
+
+bool DimacsGraphRW::provideDiGraph(DiGraph *graph)
+{
+    if (!hasInput()) {
+        return false;
+    }
+    Lines input(*this);
+    LineTokenizer &tokens = input.tokens;
+    BulkGraphBuilder builder;
+    bool problem = false;
+    std::uint64_t n = 0U;
+    std::string word;
+    while (tokens.nextLine()) {
+        switch (tokens.peek()) {
+        case '\0':
+        case 'c':
+        case 'n':
+            continue;
+        case 'p': {
+            std::uint64_t m;
+            if (problem) {
+                return grin->fail(tokens, "Duplicate problem line.");
+            }
+            tokens.readWord(word);
+            if (!tokens.readWord(word) || !tokens.readUnsigned(n) || !tokens.readUnsigned(m)) {
+                return grin->fail(tokens, "Expected \"p <problem> <vertices> <arcs>\".");
+            }
+            builder.setNumVertices(n);
+            // every arc line takes at least six bytes
+            builder.reserve(std::min<std::uint64_t>(m, tokens.getRemainingBytes() / 6U));
+            problem = true;
+            break;
+        }
+        case 'a': {
+            if (!problem) {
+                return grin->fail(tokens, "Arc before problem line.");
+            }
+            std::uint64_t tail;
+            std::uint64_t head;
+            double weight = 1.0;
+            tokens.readWord(word);
+            if (!tokens.readUnsigned(tail) || !tokens.readUnsigned(head)
+                    || tail == 0U || head == 0U || tail > n || head > n) {
+                return grin->fail(tokens, "Illegal arc.");
+            }
+            if (!tokens.atEndOfLine() && !tokens.readDouble(weight)) {
+                return grin->fail(tokens, "Illegal arc length.");
+            }
+            if (grin->weights) {
+                builder.addArc(tail - 1U, head - 1U, weight);
+            } else {
+                builder.addArc(tail - 1U, head - 1U);
+            }
+            break;
+        }
+        default:
+            return grin->fail(tokens, "Unknown line type.");
+        }
+    }
+    if (!problem) {
+        grin->lastError = "Missing problem line.";
+        return false;
+    }
+    if (!builder.build(graph, grin->weights)) {
+        grin->lastError = "Not enough memory for the graph.";
+        return false;
+    }
+    return true;
+}
+
+}
@@ -24,19 +24,45 @@ message("pri file being processed: $$PWD")
 
 HEADERS += \  
     $$PWD/streamdigraphreader.h \
+    $$PWD/textdigraphreader.h \
     $$PWD/adjacencyliststringwriter.h \
     $$PWD/streamdigraphwriter.h \
     $$PWD/adjacencyliststringformat.h \
     $$PWD/adjacencyliststringreader.h \
+    $$PWD/adjacencylistparsing.h \
     $$PWD/sparsesixgraphrw.h \
     $$PWD/sparsesixformat.h \
     $$PWD/adjacencymatrixrw.h \
-    $$PWD/linearvertexsequencetikzwriter.h
+    $$PWD/linearvertexsequencetikzwriter.h \
+    $$PWD/mappedfile.h \
+    $$PWD/parallellistreader.h \
+    $$PWD/binarygraphformat.h \
+    $$PWD/binarygraphrw.h \
+    $$PWD/nautyformatreader.h \
+    $$PWD/outputbuffer.h \
+    $$PWD/linetokenizer.h \
+    $$PWD/bulkgraphbuilder.h \
+    $$PWD/snapedgelistrw.h \
+    $$PWD/metisgraphrw.h \
+    $$PWD/dimacsgraphrw.h \
+    $$PWD/matrixmarketrw.h
 
 SOURCES += \     
     $$PWD/adjacencyliststringwriter.cpp \
     $$PWD/adjacencyliststringreader.cpp \
+    $$PWD/adjacencylistparsing.cpp \
     $$PWD/sparsesixgraphrw.cpp \
     $$PWD/sparsesixformat.cpp \
     $$PWD/adjacencymatrixrw.cpp \
-    $$PWD/linearvertexsequencetikzwriter.cpp
+    $$PWD/linearvertexsequencetikzwriter.cpp \
+    $$PWD/mappedfile.cpp \
+    $$PWD/parallellistreader.cpp \
+    $$PWD/binarygraphrw.cpp \
+    $$PWD/nautyformatreader.cpp \
+    $$PWD/linetokenizer.cpp \
+    $$PWD/textdigraphreader.cpp \
+    $$PWD/bulkgraphbuilder.cpp \
+    $$PWD/snapedgelistrw.cpp \
+    $$PWD/metisgraphrw.cpp \
+    $$PWD/dimacsgraphrw.cpp \
+    $$PWD/matrixmarketrw.cpp
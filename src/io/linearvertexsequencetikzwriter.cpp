@@ -23,7 +23,8 @@
 #include "linearvertexsequencetikzwriter.h"
 #include "graph/digraph.h"
 #include "pipe/digraphinfo.h"
-#include "property/propertymap.h"
+#include "property/fastpropertymap.h"
+#include "outputbuffer.h"
 
 namespace Algora {
 
@@ -60,57 +61,55 @@ void LinearVertexSequenceTikzWriter::processGraph(const DiGraph *graph, const Di
     }
 
     std::vector<Vertex*> vertices;
-    info->mapVertices([&](Vertex *v) { vertices.push_back(v); });
-    PropertyMap<int> vIndex(-1);
-    PropertyMap<std::string> vId("NO_ID");
-    for (unsigned int i = 0; i < vertices.size(); i++) {
-        vIndex[vertices.at(i)] = i;
-        vId[vertices.at(i)] = "v" + std::to_string(i);
-    }
+    FastPropertyMap<unsigned int> vIndex(0U);
+    info->mapVertices([&](Vertex *v) {
+        vIndex.setValue(v, vertices.size());
+        vertices.push_back(v);
+    });
+
+    OutputBuffer out(outputStream);
+    auto putId = [&out](unsigned int i) {
+        out.put('v');
+        out.putNumber(i);
+    };
 
     int yCoord = grin->vGap * grin->writtenSequences;
-    Vertex *cur = vertices.front();
+    out.put("\\node[vertex] (");
+    putId(0U);
+    out.put(") at (0,");
+    out.putNumber(yCoord);
+    out.put(") { ");
+    out.put(info->getVertexName(vertices.front()));
+    out.put(" };\n");
 
-    outputStream << "\\node[vertex] ("
-                 << vId[cur]
-                 << ") at (0,"
-                 << yCoord
-                 << ") { "
-                 << info->getVertexName(cur)
-                 << " };"
-                 << std::endl;
-
-    Vertex *last = cur;
     for (unsigned int i = 1; i < vertices.size(); i++) {
-        cur = vertices.at(i);
-        outputStream << "\\node[vertex] ("
-                     << vId[cur]
-                     << ") [right=of "
-                     << vId[last]
-                     << "] { "
-                     << info->getVertexName(cur)
-                     << " };"
-                     << std::endl;
-        last = cur;
+        out.put("\\node[vertex] (");
+        putId(i);
+        out.put(") [right=of ");
+        putId(i - 1U);
+        out.put("] { ");
+        out.put(info->getVertexName(vertices[i]));
+        out.put(" };\n");
     }
 
     for (unsigned int i = 0; i < vertices.size(); i++) {
-        cur = vertices.at(i);
-        outputStream << "% outgoing arcs of " << info->getVertexName(cur) << std::endl;
+        Vertex *cur = vertices[i];
+        out.put("% outgoing arcs of ");
+        out.put(info->getVertexName(cur));
+        out.put('\n');
         info->mapOutgoingArcs(cur, [&](Arc *a) {
-            outputStream << "\\draw[arc] ("
-                         << vId[cur];
+            out.put("\\draw[arc] (");
+            putId(i);
             if (vIndex(a->getHead()) - i == 1) {
-                outputStream << ") to (";
+                out.put(") to (");
             } else {
-                outputStream << ") to[bend left] (";
+                out.put(") to[bend left] (");
             }
-            outputStream << vId[a->getHead()]
-                         << ");"
-                         << std::endl;
-
+            putId(vIndex(a->getHead()));
+            out.put(");\n");
         });
     }
+    out.flush();
     outputStream.flush();
 }
 
@@ -0,0 +1,160 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "linetokenizer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace Algora {
+
+LineTokenizer::LineTokenizer(std::istream &input, char lineSeparator, std::size_t blockSize)
+    : input(&input), separator(lineSeparator), blockSize(blockSize < 64U ? 64U : blockSize),
+      blockEnd(nullptr), next(nullptr), lineBegin(nullptr), lineEnd(nullptr), pos(nullptr),
+      lineNumber(0U), exhausted(false)
+{
+
+}
+
+LineTokenizer::LineTokenizer(const char *begin, const char *end, char lineSeparator, std::size_t blockSize)
+    : input(nullptr), separator(lineSeparator), blockSize(blockSize < 64U ? 64U : blockSize),
+      blockEnd(end), next(begin), lineBegin(begin), lineEnd(begin), pos(begin),
+      lineNumber(0U), exhausted(true)
+{
+
+}
+
+void LineTokenizer::setInput(std::istream &in)
+{
+    if (&in == input) {
+        return;
+    }
+    input = &in;
+    blockEnd = next = lineBegin = lineEnd = pos = block.data();
+    lineNumber = 0U;
+    exhausted = false;
+}
+
+void LineTokenizer::setInput(const char *begin, const char *end)
+{
+    input = nullptr;
+    next = lineBegin = lineEnd = pos = begin;
+    blockEnd = end;
+    lineNumber = 0U;
+    // nothing to refill
+    exhausted = true;
+}
+
+bool LineTokenizer::nextLine()
+{
+    while (true) {
+        const char *newline = next == blockEnd ? nullptr : static_cast<const char*>(
+                    std::memchr(next, separator, static_cast<std::size_t>(blockEnd - next)));
+        if (newline) {
+            lineBegin = next;
+            lineEnd = newline;
+            next = newline + 1;
+            break;
+        }
+        if (exhausted) {
+            if (next == blockEnd) {
+                return false;
+            }
+            // last line without newline
+            lineBegin = next;
+            lineEnd = blockEnd;
+            next = blockEnd;
+            break;
+        }
+        refill();
+    }
+    pos = lineBegin;
+    lineNumber++;
+    return true;
+}
+
+bool LineTokenizer::returnUnread()
+{
+    auto rest = static_cast<std::streamoff>(blockEnd - next);
+    if (input == nullptr) {
+        // memory ranges are not consumed
+        return true;
+    }
+    if (rest == 0) {
+        // the stream may have been extended meanwhile
+        exhausted = false;
+        return true;
+    }
+    if (input->rdbuf()->pubseekoff(-rest, std::ios_base::cur, std::ios_base::in) == std::streampos(-1)) {
+        return false;
+    }
+    input->clear(input->rdstate() & ~std::ios_base::eofbit);
+    blockEnd = next;
+    exhausted = false;
+    return true;
+}
+
+LineTokenizer::size_type LineTokenizer::getRemainingBytes() const
+{
+    auto buffered = static_cast<size_type>(blockEnd - next);
+    if (exhausted) {
+        return buffered;
+    }
+    std::streambuf *buffer = input->rdbuf();
+    auto pos = buffer->pubseekoff(0, std::ios_base::cur, std::ios_base::in);
+    if (pos == std::streampos(-1)) {
+        return std::numeric_limits<size_type>::max();
+    }
+    auto end = buffer->pubseekoff(0, std::ios_base::end, std::ios_base::in);
+    buffer->pubseekpos(pos, std::ios_base::in);
+    if (end == std::streampos(-1) || end < pos) {
+        return std::numeric_limits<size_type>::max();
+    }
+    return buffered + static_cast<size_type>(end - pos);
+}
+
+void LineTokenizer::refill()
+{
+    // keep the incomplete line, grow the block if it is too long
+    if (block.empty()) {
+        block.resize(blockSize);
+        blockEnd = next = block.data();
+    }
+    std::size_t rest = static_cast<std::size_t>(blockEnd - next);
+    std::size_t offset = static_cast<std::size_t>(next - block.data());
+    if (rest == block.size()) {
+        block.resize(2U * block.size());
+    } else if (rest > 0U) {
+        std::memmove(block.data(), block.data() + offset, rest);
+    }
+    auto read = input->rdbuf()->sgetn(block.data() + rest, static_cast<std::streamsize>(block.size() - rest));
+    if (read <= 0) {
+        exhausted = true;
+        input->setstate(std::ios_base::eofbit);
+        read = 0;
+    }
+    next = block.data();
+    blockEnd = next + rest + static_cast<std::size_t>(read);
+}
+
+}
@@ -0,0 +1,145 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef LINETOKENIZER_H
+#define LINETOKENIZER_H
+
+#include <charconv>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace Algora {
+
+// Splits the remaining input of a stream or a memory range into lines and
+// lines into tokens separated by spaces or tabs. Memory ranges are split in
+// place. Streams are read block-wise, so the tokenizer may read ahead of the
+// current line; returnUnread() hands that input back to streams that can
+// seek. For other streams, such as pipes, keep the tokenizer to continue
+// where it stopped.
+class LineTokenizer
+{
+public:
+    typedef unsigned long long size_type;
+
+    explicit LineTokenizer(std::istream &input, char lineSeparator = '\n',
+                           std::size_t blockSize = 1U << 20);
+    // the range must stay valid while the tokenizer reads from it
+    LineTokenizer(const char *begin, const char *end, char lineSeparator = '\n',
+                  std::size_t blockSize = 1U << 20);
+
+    // continues with input; input read ahead from another stream before
+    // is discarded, the block is reused
+    void setInput(std::istream &input);
+    void setInput(const char *begin, const char *end);
+    // start of the input after the current line, within the block or range
+    const char *getPosition() const { return next; }
+
+    // advances to the next line; false at the end of the input
+    bool nextLine();
+    size_type getLineNumber() const { return lineNumber; }
+
+    // first character of the next token, or '\0' at the end of the line
+    char peek() {
+        skipBlanks();
+        return pos == lineEnd ? '\0' : *pos;
+    }
+    bool atEndOfLine() {
+        return peek() == '\0';
+    }
+    const char *getLine() const { return lineBegin; }
+    const char *getLineEnd() const { return lineEnd; }
+    std::string getLineString() const { return std::string(lineBegin, lineEnd); }
+
+    bool readUnsigned(std::uint64_t &value) {
+        skipBlanks();
+        auto result = std::from_chars(pos, lineEnd, value);
+        return finishToken(result.ptr, result.ec);
+    }
+
+    bool readDouble(double &value) {
+        skipBlanks();
+        if (pos != lineEnd && *pos == '+') {
+            pos++;
+        }
+        auto result = std::from_chars(pos, lineEnd, value);
+        return finishToken(result.ptr, result.ec);
+    }
+
+    bool readWord(std::string &word) {
+        skipBlanks();
+        const char *begin = pos;
+        while (pos != lineEnd && !isBlank(*pos)) {
+            pos++;
+        }
+        word.assign(begin, pos);
+        return begin != pos;
+    }
+
+    // repositions the stream right after the current line;
+    // false if the stream cannot seek back, the input read ahead then
+    // remains with the tokenizer
+    bool returnUnread();
+    // whether input read ahead of stream remains after the current line
+    bool hasReadAhead(const std::istream &stream) const {
+        return input == &stream && next != blockEnd;
+    }
+    // upper bound on the input left after the current line, or the maximum
+    // if the stream cannot tell
+    size_type getRemainingBytes() const;
+
+private:
+    std::istream *input;
+    char separator;
+    std::size_t blockSize;
+    // allocated on first use, unused for memory ranges
+    std::vector<char> block;
+    const char *blockEnd;
+    const char *next;
+    const char *lineBegin;
+    const char *lineEnd;
+    const char *pos;
+    size_type lineNumber;
+    bool exhausted;
+
+    static bool isBlank(char c) {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+    void skipBlanks() {
+        while (pos != lineEnd && isBlank(*pos)) {
+            pos++;
+        }
+    }
+    bool finishToken(const char *end, std::errc ec) {
+        if (ec != std::errc() || (end != lineEnd && !isBlank(*end))) {
+            return false;
+        }
+        pos = end;
+        return true;
+    }
+    void refill();
+};
+
+}
+
+#endif // LINETOKENIZER_H
@@ -0,0 +1,180 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "mappedfile.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Algora {
+
+namespace {
+int toAdvice(MappedFile::AccessPattern access)
+{
+    switch (access) {
+    case MappedFile::AccessPattern::Sequential:
+        return MADV_SEQUENTIAL;
+    case MappedFile::AccessPattern::Random:
+        return MADV_RANDOM;
+    default:
+        return MADV_NORMAL;
+    }
+}
+}
+
+MappedFile::MappedFile(const std::string &fileName, AccessPattern access)
+    : data(nullptr), length(0U), open(false)
+{
+    int fd = ::open(fileName.c_str(), O_RDONLY);
+    if (fd < 0) {
+        lastError = "Could not open " + fileName + ": " + std::strerror(errno);
+        return;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        lastError = "Could not stat " + fileName + ": " + std::strerror(errno);
+        ::close(fd);
+        return;
+    }
+    length = static_cast<size_type>(info.st_size);
+    if (length > 0U) {
+        void *mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            lastError = "Could not map " + fileName + ": " + std::strerror(errno);
+            length = 0U;
+            ::close(fd);
+            return;
+        }
+        data = static_cast<const char*>(mapping);
+    }
+    // the mapping stays valid
+    ::close(fd);
+    open = true;
+    advise(access);
+}
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+MappedFile::MappedFile(MappedFile &&other)
+    : data(other.data), length(other.length), open(other.open),
+      lastError(std::move(other.lastError))
+{
+    other.data = nullptr;
+    other.length = 0U;
+    other.open = false;
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&other)
+{
+    if (this != &other) {
+        close();
+        std::swap(data, other.data);
+        std::swap(length, other.length);
+        std::swap(open, other.open);
+        lastError = std::move(other.lastError);
+    }
+    return *this;
+}
+
+void MappedFile::advise(AccessPattern access, size_type offset, size_type len)
+{
+    adviseRange(toAdvice(access), offset, len);
+}
+
+void MappedFile::prefetch(size_type offset, size_type len)
+{
+    adviseRange(MADV_WILLNEED, offset, len);
+}
+
+void MappedFile::release(size_type offset, size_type len)
+{
+    adviseRange(MADV_DONTNEED, offset, len);
+}
+
+void MappedFile::close()
+{
+    if (data) {
+        munmap(const_cast<char*>(data), length);
+    }
+    data = nullptr;
+    length = 0U;
+    open = false;
+}
+
+bool MappedFile::adviseRange(int advice, size_type offset, size_type len)
+{
+    if (!data || offset >= length) {
+        return false;
+    }
+    // madvise needs page-aligned addresses
+    static const size_type pageSize = static_cast<size_type>(sysconf(_SC_PAGESIZE));
+    size_type alignedOffset = offset - offset % pageSize;
+    len = std::min(len, length - offset) + (offset - alignedOffset);
+    return madvise(const_cast<char*>(data) + alignedOffset, len, advice) == 0;
+}
+
+MemoryStreamBuffer::pos_type MemoryStreamBuffer::seekoff(off_type off, std::ios_base::seekdir dir,
+                                                         std::ios_base::openmode which)
+{
+    if (!(which & std::ios_base::in)) {
+        return pos_type(off_type(-1));
+    }
+    char *target;
+    if (dir == std::ios_base::beg) {
+        target = eback() + off;
+    } else if (dir == std::ios_base::cur) {
+        target = gptr() + off;
+    } else {
+        target = egptr() + off;
+    }
+    if (target < eback() || target > egptr()) {
+        return pos_type(off_type(-1));
+    }
+    setg(eback(), target, egptr());
+    return pos_type(target - eback());
+}
+
+MemoryStreamBuffer::pos_type MemoryStreamBuffer::seekpos(pos_type pos, std::ios_base::openmode which)
+{
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+MappedFileStream::MappedFileStream(const std::string &fileName, MappedFile::AccessPattern access)
+    : std::istream(nullptr), file(fileName, access), buffer(file.begin(), file.end())
+{
+    rdbuf(&buffer);
+    if (!file.isOpen()) {
+        setstate(std::ios_base::failbit);
+    }
+}
+
+}
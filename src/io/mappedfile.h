@@ -0,0 +1,113 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <istream>
+#include <streambuf>
+#include <string>
+
+namespace Algora {
+
+// Read-only memory mapping of a whole file.
+class MappedFile
+{
+public:
+    typedef std::size_t size_type;
+
+    enum class AccessPattern { Normal, Sequential, Random };
+
+    explicit MappedFile(const std::string &fileName,
+                        AccessPattern access = AccessPattern::Sequential);
+    ~MappedFile();
+
+    MappedFile(const MappedFile &other) = delete;
+    MappedFile &operator=(const MappedFile &other) = delete;
+    MappedFile(MappedFile &&other);
+    MappedFile &operator=(MappedFile &&other);
+
+    bool isOpen() const { return open; }
+    const std::string &getLastError() const { return lastError; }
+
+    const char *begin() const { return data; }
+    const char *end() const { return data + length; }
+    size_type size() const { return length; }
+
+    // hints for the kernel, all ranges are clipped to the file
+    void advise(AccessPattern access, size_type offset = 0U, size_type len = ~size_type(0U));
+    void prefetch(size_type offset = 0U, size_type len = ~size_type(0U));
+    void release(size_type offset = 0U, size_type len = ~size_type(0U));
+
+    void close();
+
+private:
+    const char *data;
+    size_type length;
+    bool open;
+    std::string lastError;
+
+    bool adviseRange(int advice, size_type offset, size_type len);
+};
+
+// Stream buffer that reads from a fixed memory range in place.
+class MemoryStreamBuffer : public std::streambuf
+{
+public:
+    MemoryStreamBuffer(const char *begin = nullptr, const char *end = nullptr) {
+        setRange(begin, end);
+    }
+
+    void setRange(const char *begin, const char *end) {
+        char *b = const_cast<char*>(begin);
+        setg(b, b, const_cast<char*>(end));
+    }
+
+protected:
+    virtual pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+                             std::ios_base::openmode which = std::ios_base::in) override;
+    virtual pos_type seekpos(pos_type pos,
+                             std::ios_base::openmode which = std::ios_base::in) override;
+};
+
+// Input stream over a memory-mapped file, usable with all
+// StreamDiGraphReaders without copying the file contents into a stream
+// buffer. Readers that read block-wise still copy into their blocks;
+// TextDiGraphReader::setInput() parses the mapping in place instead.
+// If the file cannot be mapped, the stream's failbit is set.
+class MappedFileStream : public std::istream
+{
+public:
+    explicit MappedFileStream(const std::string &fileName,
+                              MappedFile::AccessPattern access = MappedFile::AccessPattern::Sequential);
+    virtual ~MappedFileStream() override { }
+
+    MappedFile &getFile() { return file; }
+
+private:
+    MappedFile file;
+    MemoryStreamBuffer buffer;
+};
+
+}
+
+#endif // MAPPEDFILE_H
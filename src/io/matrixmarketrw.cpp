@@ -0,0 +1,219 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "matrixmarketrw.h"
+
+#include "linetokenizer.h"
+#include "bulkgraphbuilder.h"
+#include "outputbuffer.h"
+#include "graph/digraph.h"
+#include "property/fastpropertymap.h"
+#include "pipe/digraphinfo.h"
+
+#include <algorithm>
+#include <cctype>
+#include <limits>
+#include <vector>
+
+namespace Algora {
+
+class MatrixMarketRW::CheshireCat {
+public:
+    ModifiableProperty<double> *weights;
+    std::string lastError;
+
+    CheshireCat() : weights(nullptr) { }
+
+    bool fail(const LineTokenizer &tokens, const std::string &error) {
+        lastError = "Line " + std::to_string(tokens.getLineNumber()) + ": " + error;
+        return false;
+    }
+};
+
+MatrixMarketRW::MatrixMarketRW()
+    : grin(new CheshireCat)
+{
+
+}
+
+MatrixMarketRW::~MatrixMarketRW()
+{
+    delete grin;
+}
+
+void MatrixMarketRW::useArcWeights(ModifiableProperty<double> *weights)
+{
+    grin->weights = weights;
+}
+
+std::string MatrixMarketRW::getLastError() const
+{
+    return grin->lastError;
+}
+
+void MatrixMarketRW::processGraph(const DiGraph *graph, const DiGraphInfo *info)
+{
+    if (StreamDiGraphWriter::outputStream == nullptr) {
+        return;
+    }
+    DiGraph *ncGraph = const_cast<DiGraph*>(graph);
+    DiGraphInfo defaultInfo(ncGraph);
+    if (!info) {
+        info = &defaultInfo;
+    }
+    std::vector<Vertex*> vertices;
+    FastPropertyMap<unsigned long long> index(0U);
+    info->mapVertices([&](Vertex *v) {
+        index.setValue(v, vertices.size());
+        vertices.push_back(v);
+    });
+
+    // a filtering info may hide arcs, so count those that are written
+    DiGraph::size_type numArcs = 0U;
+    if (info == &defaultInfo) {
+        numArcs = ncGraph->getNumArcs(true);
+    } else {
+        for (Vertex *v : vertices) {
+            info->mapOutgoingArcs(v, [&numArcs](Arc *) { numArcs++; });
+        }
+    }
+
+    OutputBuffer out(*(StreamDiGraphWriter::outputStream));
+    out.put(grin->weights ? "%%MatrixMarket matrix coordinate real general\n"
+                          : "%%MatrixMarket matrix coordinate pattern general\n");
+    out.putNumber(vertices.size());
+    out.put(' ');
+    out.putNumber(vertices.size());
+    out.put(' ');
+    out.putNumber(numArcs);
+    out.put('\n');
+    for (Vertex *v : vertices) {
+        auto row = index(v) + 1U;
+        info->mapOutgoingArcs(v, [&](Arc *a) {
+            out.putNumber(row);
+            out.put(' ');
+            out.putNumber(index(a->getHead()) + 1U);
+            if (grin->weights) {
+                out.put(' ');
+                out.putNumber(grin->weights->getValue(a));
+            }
+            out.put('\n');
+        });
+    }
+}
+
+bool MatrixMarketRW::provideDiGraph(DiGraph *graph)
+{
+    if (!hasInput()) {
+        return false;
+    }
+    Lines input(*this);
+    LineTokenizer &tokens = input.tokens;
+    std::string banner;
+    if (!tokens.nextLine() || !tokens.readWord(banner) || banner != "%%MatrixMarket") {
+        return grin->fail(tokens, "Missing %%MatrixMarket banner.");
+    }
+    std::string words[4];
+    for (auto &w : words) {
+        tokens.readWord(w);
+        std::transform(w.begin(), w.end(), w.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    }
+    const std::string &object = words[0];
+    const std::string &format = words[1];
+    const std::string &field = words[2];
+    const std::string &symmetry = words[3];
+    if (object != "matrix" || format != "coordinate") {
+        return grin->fail(tokens, "Only coordinate matrices are supported.");
+    }
+    if (field != "real" && field != "double" && field != "integer" && field != "pattern") {
+        return grin->fail(tokens, "Unsupported field " + field + ".");
+    }
+    if (symmetry != "general" && symmetry != "symmetric" && symmetry != "skew-symmetric"
+            && symmetry != "hermitian") {
+        return grin->fail(tokens, "Unsupported symmetry " + symmetry + ".");
+    }
+    const bool values = field != "pattern";
+    const bool mirror = symmetry != "general";
+    const double mirrorFactor = symmetry == "skew-symmetric" ? -1.0 : 1.0;
+
+    auto nextLine = [&tokens]() {
+        while (tokens.nextLine()) {
+            char c = tokens.peek();
+            if (c != '\0' && c != '%') {
+                return true;
+            }
+        }
+        return false;
+    };
+    std::uint64_t rows;
+    std::uint64_t cols;
+    std::uint64_t entries;
+    if (!nextLine() || !tokens.readUnsigned(rows) || !tokens.readUnsigned(cols)
+            || !tokens.readUnsigned(entries)) {
+        return grin->fail(tokens, "Expected \"<rows> <columns> <entries>\".");
+    }
+    if (mirror && entries > std::numeric_limits<std::uint64_t>::max() / 2U) {
+        return grin->fail(tokens, "Illegal number of entries.");
+    }
+
+    BulkGraphBuilder builder;
+    builder.setNumVertices(std::max(rows, cols));
+    // every entry takes at least four bytes
+    auto reservedEntries = std::min<std::uint64_t>(entries, tokens.getRemainingBytes() / 4U);
+    builder.reserve(mirror ? 2U * reservedEntries : reservedEntries);
+    for (std::uint64_t k = 0U; k < entries; k++) {
+        if (!nextLine()) {
+            grin->lastError = "Expected " + std::to_string(entries) + " entries, found "
+                    + std::to_string(k) + ".";
+            return false;
+        }
+        std::uint64_t i;
+        std::uint64_t j;
+        double value = 1.0;
+        if (!tokens.readUnsigned(i) || !tokens.readUnsigned(j)
+                || i == 0U || j == 0U || i > rows || j > cols) {
+            return grin->fail(tokens, "Illegal entry.");
+        }
+        if (values && !tokens.readDouble(value)) {
+            return grin->fail(tokens, "Illegal value.");
+        }
+        if (grin->weights) {
+            builder.addArc(i - 1U, j - 1U, value);
+            if (mirror && i != j) {
+                builder.addArc(j - 1U, i - 1U, mirrorFactor * value);
+            }
+        } else {
+            builder.addArc(i - 1U, j - 1U);
+            if (mirror && i != j) {
+                builder.addArc(j - 1U, i - 1U);
+            }
+        }
+    }
+    if (!builder.build(graph, grin->weights)) {
+        grin->lastError = "Not enough memory for the graph.";
+        return false;
+    }
+    return true;
+}
+
+}
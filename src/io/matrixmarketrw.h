@@ -0,0 +1,65 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef MATRIXMARKETRW_H
+#define MATRIXMARKETRW_H
+
+#include "streamdigraphwriter.h"
+#include "textdigraphreader.h"
+#include "property/modifiableproperty.h"
+
+#include <string>
+
+namespace Algora {
+
+// Matrix Market coordinate format: entry (i, j) becomes an arc from vertex
+// i to vertex j (1-based), the value its weight. A non-square matrix yields
+// as many vertices as its larger dimension. For symmetric, skew-symmetric
+// and hermitian matrices, the mirrored arcs are added as well; complex and
+// dense (array) matrices are not supported.
+class MatrixMarketRW : public TextDiGraphReader, public StreamDiGraphWriter
+{
+public:
+    MatrixMarketRW();
+    virtual ~MatrixMarketRW() override;
+
+    // arc weights are read into and written from this property, if set
+    void useArcWeights(ModifiableProperty<double> *weights);
+
+    std::string getLastError() const;
+
+    // DiGraphProcessor interface
+public:
+    virtual void processGraph(const DiGraph *graph, const DiGraphInfo *info = nullptr) override;
+
+    // DiGraphProvider interface
+public:
+    virtual bool provideDiGraph(DiGraph *graph) override;
+
+private:
+    class CheshireCat;
+    CheshireCat *grin;
+};
+
+}
+
+#endif // MATRIXMARKETRW_H
@@ -0,0 +1,218 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "metisgraphrw.h"
+
+#include "linetokenizer.h"
+#include "bulkgraphbuilder.h"
+#include "outputbuffer.h"
+#include "graph/digraph.h"
+#include "property/fastpropertymap.h"
+#include "pipe/digraphinfo.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace Algora {
+
+class MetisGraphRW::CheshireCat {
+public:
+    ModifiableProperty<double> *weights;
+    std::string lastError;
+
+    CheshireCat() : weights(nullptr) { }
+
+    bool fail(const LineTokenizer &tokens, const std::string &error) {
+        lastError = "Line " + std::to_string(tokens.getLineNumber()) + ": " + error;
+        return false;
+    }
+};
+
+MetisGraphRW::MetisGraphRW()
+    : grin(new CheshireCat)
+{
+
+}
+
+MetisGraphRW::~MetisGraphRW()
+{
+    delete grin;
+}
+
+void MetisGraphRW::useArcWeights(ModifiableProperty<double> *weights)
+{
+    grin->weights = weights;
+}
+
+std::string MetisGraphRW::getLastError() const
+{
+    return grin->lastError;
+}
+
+void MetisGraphRW::processGraph(const DiGraph *graph, const DiGraphInfo *info)
+{
+    if (StreamDiGraphWriter::outputStream == nullptr) {
+        return;
+    }
+    DiGraph *ncGraph = const_cast<DiGraph*>(graph);
+    DiGraphInfo defaultInfo(ncGraph);
+    if (!info) {
+        info = &defaultInfo;
+    }
+    std::vector<Vertex*> vertices;
+    FastPropertyMap<unsigned long long> index(0U);
+    info->mapVertices([&](Vertex *v) {
+        index.setValue(v, vertices.size());
+        vertices.push_back(v);
+    });
+
+    // neighbors in the underlying undirected simple graph, without loops
+    const auto none = static_cast<unsigned long long>(vertices.size());
+    std::vector<unsigned long long> seenBy(vertices.size(), none);
+    auto mapNeighbors = [&](unsigned long long i, const std::function<void(unsigned long long, Arc*)> &fun) {
+        auto visit = [&](unsigned long long j, Arc *a) {
+            if (j != i && seenBy[j] != i) {
+                seenBy[j] = i;
+                fun(j, a);
+            }
+        };
+        info->mapOutgoingArcs(vertices[i], [&](Arc *a) { visit(index(a->getHead()), a); });
+        info->mapIncomingArcs(vertices[i], [&](Arc *a) { visit(index(a->getTail()), a); });
+    };
+    unsigned long long entries = 0U;
+    for (auto i = 0ULL; i < vertices.size(); i++) {
+        mapNeighbors(i, [&](unsigned long long, Arc*) { entries++; });
+    }
+    std::fill(seenBy.begin(), seenBy.end(), none);
+
+    OutputBuffer out(*(StreamDiGraphWriter::outputStream));
+    out.putNumber(vertices.size());
+    out.put(' ');
+    out.putNumber(entries / 2U);
+    out.put(grin->weights ? " 1\n" : "\n");
+    for (auto i = 0ULL; i < vertices.size(); i++) {
+        bool first = true;
+        mapNeighbors(i, [&](unsigned long long j, Arc *a) {
+            if (!first) {
+                out.put(' ');
+            }
+            first = false;
+            out.putNumber(j + 1U);
+            if (grin->weights) {
+                out.put(' ');
+                out.putNumber(std::llround(grin->weights->getValue(a)));
+            }
+        });
+        out.put('\n');
+    }
+}
+
+bool MetisGraphRW::provideDiGraph(DiGraph *graph)
+{
+    if (!hasInput()) {
+        return false;
+    }
+    Lines input(*this);
+    LineTokenizer &tokens = input.tokens;
+    auto nextLine = [&tokens]() {
+        while (tokens.nextLine()) {
+            if (tokens.peek() != '%') {
+                return true;
+            }
+        }
+        return false;
+    };
+    do {
+        if (!nextLine()) {
+            grin->lastError = "Missing header.";
+            return false;
+        }
+    } while (tokens.atEndOfLine());
+
+    std::uint64_t n;
+    std::uint64_t m;
+    std::string fmt = "0";
+    std::uint64_t ncon = 1U;
+    if (!tokens.readUnsigned(n) || !tokens.readUnsigned(m)) {
+        return grin->fail(tokens, "Expected number of vertices and edges.");
+    }
+    if (m > std::numeric_limits<std::uint64_t>::max() / 2U) {
+        return grin->fail(tokens, "Illegal number of edges.");
+    }
+    if (!tokens.atEndOfLine() && (!tokens.readWord(fmt) || fmt.size() > 3U
+                                  || fmt.find_first_not_of("01") != std::string::npos)) {
+        return grin->fail(tokens, "Illegal format " + fmt + ".");
+    }
+    if (!tokens.atEndOfLine() && !tokens.readUnsigned(ncon)) {
+        return grin->fail(tokens, "Illegal number of vertex weights.");
+    }
+    fmt.insert(0U, 3U - fmt.size(), '0');
+    const bool vertexSizes = fmt[0] == '1';
+    const bool vertexWeights = fmt[1] == '1';
+    const bool edgeWeights = fmt[2] == '1';
+
+    BulkGraphBuilder builder;
+    builder.setNumVertices(n);
+    // every adjacency entry takes at least two bytes
+    builder.reserve(std::min<std::uint64_t>(2U * m, tokens.getRemainingBytes() / 2U));
+    for (std::uint64_t i = 0U; i < n; i++) {
+        if (!nextLine()) {
+            grin->lastError = "Missing adjacency list of vertex " + std::to_string(i + 1U) + ".";
+            return false;
+        }
+        double skipped;
+        for (std::uint64_t k = (vertexSizes ? 1U : 0U) + (vertexWeights ? ncon : 0U); k > 0U; k--) {
+            if (!tokens.readDouble(skipped)) {
+                return grin->fail(tokens, "Illegal vertex size or weight.");
+            }
+        }
+        while (!tokens.atEndOfLine()) {
+            std::uint64_t j;
+            if (!tokens.readUnsigned(j) || j == 0U || j > n) {
+                return grin->fail(tokens, "Illegal neighbor.");
+            }
+            if (edgeWeights) {
+                double weight;
+                if (!tokens.readDouble(weight)) {
+                    return grin->fail(tokens, "Illegal edge weight.");
+                }
+                builder.addArc(i, j - 1U, weight);
+            } else {
+                builder.addArc(i, j - 1U);
+            }
+        }
+    }
+    if (builder.getNumArcs() != 2U * m) {
+        grin->lastError = "Expected " + std::to_string(2U * m) + " adjacency entries, found "
+                + std::to_string(builder.getNumArcs()) + ".";
+        return false;
+    }
+    if (!builder.build(graph, grin->weights)) {
+        grin->lastError = "Not enough memory for the graph.";
+        return false;
+    }
+    return true;
+}
+
+}
@@ -0,0 +1,66 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef METISGRAPHRW_H
+#define METISGRAPHRW_H
+
+#include "streamdigraphwriter.h"
+#include "textdigraphreader.h"
+#include "property/modifiableproperty.h"
+
+#include <string>
+
+namespace Algora {
+
+// METIS graph files: a header "n m [fmt [ncon]]" followed by one line per
+// vertex listing its (1-based) neighbors, optionally with edge weights;
+// vertex sizes and weights are skipped. Lines starting with '%' are comments.
+// Each neighbor entry becomes an arc, so an undirected edge yields two arcs.
+// The writer lists the neighbors of the underlying undirected simple graph
+// and writes weights rounded to integers, as METIS requires.
+class MetisGraphRW : public TextDiGraphReader, public StreamDiGraphWriter
+{
+public:
+    MetisGraphRW();
+    virtual ~MetisGraphRW() override;
+
+    // arc weights are read into and written from this property, if set
+    void useArcWeights(ModifiableProperty<double> *weights);
+
+    std::string getLastError() const;
+
+    // DiGraphProcessor interface
+public:
+    virtual void processGraph(const DiGraph *graph, const DiGraphInfo *info = nullptr) override;
+
+    // DiGraphProvider interface
+public:
+    virtual bool provideDiGraph(DiGraph *graph) override;
+
+private:
+    class CheshireCat;
+    CheshireCat *grin;
+};
+
+}
+
+#endif // METISGRAPHRW_H
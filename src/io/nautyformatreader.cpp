@@ -0,0 +1,287 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "nautyformatreader.h"
+
+#include "sparsesixformat.h"
+#include "graph/digraph.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+namespace Algora {
+
+class NautyFormatReader::CheshireCat {
+public:
+    bool symmetric;
+    size_type graphsRead;
+    std::string lastError;
+    std::string line;
+    std::vector<Vertex*> vertices;
+
+    CheshireCat(bool s) : symmetric(s), graphsRead(0U) { }
+
+    bool fail(const std::string &error) {
+        lastError = "Graph " + std::to_string(graphsRead) + ": " + error;
+        return false;
+    }
+
+    bool readLine(std::istream &input);
+    bool parseGraph(const char *begin, const char *end, DiGraph *graph);
+    bool parseHeader(const char *&begin, const char *end, std::uint64_t &n);
+    bool addVertices(DiGraph *graph, std::uint64_t n);
+    void addEdge(DiGraph *graph, std::uint64_t u, std::uint64_t v) {
+        graph->addArc(vertices[u], vertices[v]);
+        if (symmetric && u != v) {
+            graph->addArc(vertices[v], vertices[u]);
+        }
+    }
+    bool graphSix(const char *begin, const char *end, DiGraph *graph);
+    bool sparseSix(const char *begin, const char *end, DiGraph *graph);
+    bool digraphSix(const char *begin, const char *end, DiGraph *graph);
+};
+
+NautyFormatReader::NautyFormatReader(std::istream *input, bool symmetric)
+    : StreamDiGraphReader(input), grin(new CheshireCat(symmetric))
+{
+
+}
+
+NautyFormatReader::~NautyFormatReader()
+{
+    delete grin;
+}
+
+void NautyFormatReader::setSymmetric(bool symmetric)
+{
+    grin->symmetric = symmetric;
+}
+
+NautyFormatReader::size_type NautyFormatReader::mapGraphs(DiGraph *graph, const std::function<bool (DiGraph *)> &fun)
+{
+    size_type processed = 0U;
+    while (isGraphAvailable()) {
+        graph->clear();
+        if (!provideDiGraph(graph)) {
+            break;
+        }
+        processed++;
+        if (!fun(graph)) {
+            break;
+        }
+    }
+    return processed;
+}
+
+NautyFormatReader::size_type NautyFormatReader::getNumGraphsRead() const
+{
+    return grin->graphsRead;
+}
+
+std::string NautyFormatReader::getLastError() const
+{
+    return grin->lastError;
+}
+
+bool NautyFormatReader::provideDiGraph(DiGraph *graph)
+{
+    if (inputStream == nullptr) {
+        return false;
+    }
+    if (!grin->readLine(*inputStream)) {
+        return grin->fail("No input.");
+    }
+    const char *begin = grin->line.data();
+    const char *end = begin + grin->line.size();
+    bool ok = grin->parseGraph(begin, end, graph);
+    grin->graphsRead++;
+    return ok;
+}
+
+bool NautyFormatReader::CheshireCat::readLine(std::istream &input)
+{
+    if (!std::getline(input, line)) {
+        return false;
+    }
+    if (!line.empty() && line.back() == '\r') {
+        line.pop_back();
+    }
+    return true;
+}
+
+bool NautyFormatReader::CheshireCat::parseGraph(const char *begin, const char *end, DiGraph *graph)
+{
+    if (end - begin >= 2 && begin[0] == '>' && begin[1] == '>') {
+        const char *header = std::search(begin, end, "<<", "<<" + 2);
+        if (header == end) {
+            return fail("Unterminated header.");
+        }
+        begin = header + 2;
+    }
+    if (begin == end) {
+        return fail("Empty line.");
+    }
+    switch (*begin) {
+    case ':':
+        return sparseSix(begin + 1, end, graph);
+    case '&':
+        return digraphSix(begin + 1, end, graph);
+    case ';':
+        return fail("Incremental sparse6 is not supported.");
+    default:
+        return graphSix(begin, end, graph);
+    }
+}
+
+bool NautyFormatReader::CheshireCat::parseHeader(const char *&begin, const char *end, std::uint64_t &n)
+{
+    for (const char *c = begin; c != end; c++) {
+        if (*c < 63 || *c > 126) {
+            return fail("Illegal character '" + std::string(1, *c) + "'.");
+        }
+    }
+    if (!parseSparseSixN(begin, end, n)) {
+        return fail("Could not read number of vertices.");
+    }
+    return true;
+}
+
+bool NautyFormatReader::CheshireCat::addVertices(DiGraph *graph, std::uint64_t n)
+{
+    vertices.clear();
+    try {
+        vertices.reserve(n);
+        for (std::uint64_t i = 0U; i < n; i++) {
+            vertices.push_back(graph->addVertex());
+        }
+    } catch (const std::length_error &) {
+        return fail("Not enough memory for the graph.");
+    } catch (const std::bad_alloc &) {
+        return fail("Not enough memory for the graph.");
+    }
+    return true;
+}
+
+bool NautyFormatReader::CheshireCat::graphSix(const char *begin, const char *end, DiGraph *graph)
+{
+    std::uint64_t n;
+    if (!parseHeader(begin, end, n)) {
+        return false;
+    }
+    // n * (n - 1) / 2 bits must fit into 6 bits per character; checked by
+    // division, as n may be up to 2^36
+    auto available = 12U * static_cast<std::uint64_t>(end - begin);
+    if (n > 0U && n - 1U > available / n) {
+        return fail("Adjacency matrix too short.");
+    }
+    std::uint64_t bits = n * (n - (n > 0U ? 1U : 0U)) / 2U;
+    if (!addVertices(graph, n)) {
+        return false;
+    }
+    graph->beginTransaction();
+    // upper triangle, column by column
+    std::uint64_t i = 0U;
+    std::uint64_t j = 1U;
+    for (std::uint64_t b = 0U; b < bits; b += 6U) {
+        unsigned int value = static_cast<unsigned int>(*begin++ - 63);
+        for (unsigned int k = 0U; k < 6U && b + k < bits; k++) {
+            if (value & (32U >> k)) {
+                addEdge(graph, i, j);
+            }
+            if (++i == j) {
+                i = 0U;
+                j++;
+            }
+        }
+    }
+    graph->commitTransaction();
+    return true;
+}
+
+bool NautyFormatReader::CheshireCat::sparseSix(const char *begin, const char *end, DiGraph *graph)
+{
+    const char *edgesEnd = std::find(begin, end, ':');
+    std::uint64_t n;
+    if (!parseHeader(begin, edgesEnd, n)) {
+        return false;
+    }
+    if (!addVertices(graph, n)) {
+        return false;
+    }
+    graph->beginTransaction();
+    if (edgesEnd == end) {
+        decodeSparseSixEdges(begin, edgesEnd, n, [this,graph](std::uint64_t v, std::uint64_t u) {
+            addEdge(graph, u, v);
+        });
+    } else {
+        SparseSixBitReader directionBits(edgesEnd + 1, end);
+        decodeSparseSixEdges(begin, edgesEnd, n, [&](std::uint64_t v, std::uint64_t u) {
+            if (directionBits.getBit()) {
+                addEdge(graph, v, u);
+            } else {
+                addEdge(graph, u, v);
+            }
+        });
+    }
+    graph->commitTransaction();
+    return true;
+}
+
+bool NautyFormatReader::CheshireCat::digraphSix(const char *begin, const char *end, DiGraph *graph)
+{
+    std::uint64_t n;
+    if (!parseHeader(begin, end, n)) {
+        return false;
+    }
+    // n * n bits, see graphSix()
+    auto available = 6U * static_cast<std::uint64_t>(end - begin);
+    if (n > 0U && n > available / n) {
+        return fail("Adjacency matrix too short.");
+    }
+    std::uint64_t bits = n * n;
+    if (!addVertices(graph, n)) {
+        return false;
+    }
+    graph->beginTransaction();
+    // full matrix, row by row
+    std::uint64_t i = 0U;
+    std::uint64_t j = 0U;
+    for (std::uint64_t b = 0U; b < bits; b += 6U) {
+        unsigned int value = static_cast<unsigned int>(*begin++ - 63);
+        for (unsigned int k = 0U; k < 6U && b + k < bits; k++) {
+            if (value & (32U >> k)) {
+                graph->addArc(vertices[i], vertices[j]);
+            }
+            if (++j == n) {
+                j = 0U;
+                i++;
+            }
+        }
+    }
+    graph->commitTransaction();
+    return true;
+}
+
+}
@@ -0,0 +1,71 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef NAUTYFORMATREADER_H
+#define NAUTYFORMATREADER_H
+
+#include "streamdigraphreader.h"
+
+#include <functional>
+#include <string>
+
+namespace Algora {
+
+// Reads collections of graphs, one per line, in graph6, sparse6 or
+// digraph6 format; the format is detected per line and optional
+// ">>graph6<<" etc. headers are skipped. Lines in sparse6 format may carry
+// direction bits after a second ':', as written by SparseSixGraphRW.
+// Undirected edges become arcs from the smaller to the larger vertex index,
+// or a pair of antiparallel arcs if symmetric is set.
+// Buffers are reused, so reading many small graphs into the same graph
+// object (see mapGraphs()) avoids allocations almost entirely.
+class NautyFormatReader : public StreamDiGraphReader
+{
+public:
+    typedef unsigned long long size_type;
+
+    explicit NautyFormatReader(std::istream *input = nullptr, bool symmetric = false);
+    virtual ~NautyFormatReader() override;
+
+    void setSymmetric(bool symmetric);
+
+    // clears graph, reads the next graph into it and calls fun, until the
+    // input is exhausted, reading fails or fun returns false;
+    // returns the number of graphs processed
+    size_type mapGraphs(DiGraph *graph, const std::function<bool(DiGraph*)> &fun);
+
+    // number of graphs (lines) read so far
+    size_type getNumGraphsRead() const;
+    std::string getLastError() const;
+
+    // DiGraphProvider interface
+public:
+    virtual bool provideDiGraph(DiGraph *graph) override;
+
+private:
+    class CheshireCat;
+    CheshireCat *grin;
+};
+
+}
+
+#endif // NAUTYFORMATREADER_H
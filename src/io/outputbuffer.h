@@ -0,0 +1,111 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef OUTPUTBUFFER_H
+#define OUTPUTBUFFER_H
+
+#include <algorithm>
+#include <charconv>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Algora {
+
+// Collects output in a large buffer and hands it to the stream in few,
+// large writes. Numbers are formatted with std::to_chars, without locale
+// or stream state. The buffer is flushed on destruction.
+class OutputBuffer
+{
+public:
+    explicit OutputBuffer(std::ostream &out, std::size_t capacity = 1U << 20)
+        : out(out), buffer(capacity < 64U ? 64U : capacity), used(0U) { }
+    ~OutputBuffer() {
+        flush();
+    }
+
+    OutputBuffer(const OutputBuffer &other) = delete;
+    OutputBuffer &operator=(const OutputBuffer &other) = delete;
+
+    void put(char c) {
+        if (used == buffer.size()) {
+            flush();
+        }
+        buffer[used++] = c;
+    }
+
+    void put(const char *s, std::size_t length) {
+        if (used + length > buffer.size()) {
+            flush();
+            if (length > buffer.size()) {
+                out.write(s, static_cast<std::streamsize>(length));
+                return;
+            }
+        }
+        std::copy(s, s + length, buffer.data() + used);
+        used += length;
+    }
+
+    template<std::size_t N>
+    void put(const char (&s)[N]) {
+        put(s, N - 1U);
+    }
+
+    void put(const std::string &s) {
+        put(s.data(), s.size());
+    }
+
+    template<typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+    void putNumber(T value) {
+        if (used + 24U > buffer.size()) {
+            flush();
+        }
+        char *end = buffer.data() + used;
+        used = static_cast<std::size_t>(std::to_chars(end, end + 24, value).ptr - buffer.data());
+    }
+
+    // shortest representation that reads back to the same value
+    void putNumber(double value) {
+        if (used + 32U > buffer.size()) {
+            flush();
+        }
+        char *end = buffer.data() + used;
+        used = static_cast<std::size_t>(std::to_chars(end, end + 32, value).ptr - buffer.data());
+    }
+
+    void flush() {
+        if (used > 0U) {
+            out.write(buffer.data(), static_cast<std::streamsize>(used));
+            used = 0U;
+        }
+    }
+
+private:
+    std::ostream &out;
+    std::vector<char> buffer;
+    std::size_t used;
+};
+
+}
+
+#endif // OUTPUTBUFFER_H
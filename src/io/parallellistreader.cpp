@@ -0,0 +1,418 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "parallellistreader.h"
+
+#include "adjacencylistparsing.h"
+#include "bulkgraphbuilder.h"
+#include "mappedfile.h"
+#include "graph/digraph.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace Algora {
+
+using AdjacencyListParsing::parseInt;
+
+typedef std::size_t size_type;
+
+// don't bother spawning threads for less input than that
+static const size_type MIN_BYTES_PER_THREAD = 1U << 20;
+
+struct Chunk {
+    const char *begin;
+    const char *end;
+    size_type firstLine;
+    size_type numLines;
+    std::vector<std::pair<int,int>> arcs;
+    int maxId;
+    bool failed;
+    std::string error;
+    // adjacency lists: end of the last line of the graph, if in this chunk
+    const char *graphEnd;
+
+    Chunk(const char *b, const char *e)
+        : begin(b), end(e), firstLine(0U), numLines(0U), maxId(-1), failed(false), graphEnd(nullptr) { }
+};
+
+class ParallelListReader::CheshireCat {
+public:
+    Format format;
+    AdjacencyListStringFormat separators;
+    unsigned int numThreads;
+    const char *position;
+    const char *end;
+    std::string lastError;
+
+    CheshireCat(Format f, AdjacencyListStringFormat s, unsigned int t)
+        : format(f), separators(s), numThreads(t), position(nullptr), end(nullptr) { }
+
+    const char *lineEnd(const char *p, const char *e) const {
+        auto eol = static_cast<const char*>(std::memchr(p, separators.getVertexSeparator(),
+                                                         static_cast<size_type>(e - p)));
+        return eol ? eol : e;
+    }
+
+    // calls f(begin, end) for each token of the line, i.e., the same tokens
+    // getline would produce; stops as soon as f returns false
+    template<typename F>
+    bool forEachToken(const char *p, const char *eol, const F &f) const {
+        auto sep = separators.getArcSeparator();
+        while (p != eol) {
+            auto t = static_cast<const char*>(std::memchr(p, sep, static_cast<size_type>(eol - p)));
+            if (!t) {
+                return f(p, eol);
+            }
+            if (!f(p, t)) {
+                return false;
+            }
+            p = t + 1;
+        }
+        return true;
+    }
+
+    bool toInt(const char *b, const char *e, int *i, std::string &err) const {
+        auto [pos, ec] = std::from_chars(b, e, *i);
+        if (ec == std::errc() && pos == e) {
+            return true;
+        }
+        // slow path, for whitespace, signs and error messages
+        return parseInt(std::string(b, e), i, err);
+    }
+
+    std::vector<Chunk> split(const char *b, const char *e) const;
+    void countLines(Chunk &chunk) const;
+    void parseAdjacencyLists(Chunk &chunk, int numVertices) const;
+    void parseEdges(Chunk &chunk) const;
+    template<typename F>
+    void runParallel(std::vector<Chunk> &chunks, const F &f) const;
+    bool provideFromAdjacencyLists(DiGraph *graph);
+    bool provideFromEdgeList(DiGraph *graph);
+    void build(DiGraph *graph, int numVertices, const std::vector<Chunk> &chunks) const;
+};
+
+ParallelListReader::ParallelListReader(Format format, AdjacencyListStringFormat separators,
+                                       unsigned int numThreads)
+    : grin(new CheshireCat(format, separators, numThreads))
+{
+
+}
+
+ParallelListReader::~ParallelListReader()
+{
+    delete grin;
+}
+
+void ParallelListReader::setInput(const char *begin, const char *end)
+{
+    grin->position = begin;
+    grin->end = end;
+}
+
+void ParallelListReader::setInput(const MappedFile &file)
+{
+    setInput(file.begin(), file.end());
+}
+
+void ParallelListReader::setNumThreads(unsigned int numThreads)
+{
+    grin->numThreads = numThreads;
+}
+
+const char *ParallelListReader::getPosition() const
+{
+    return grin->position;
+}
+
+std::string ParallelListReader::getLastError() const
+{
+    return grin->lastError;
+}
+
+bool ParallelListReader::isGraphAvailable()
+{
+    return grin->position != nullptr && grin->position < grin->end;
+}
+
+bool ParallelListReader::provideDiGraph(DiGraph *graph)
+{
+    if (!isGraphAvailable()) {
+        grin->lastError = "No input available.";
+        return false;
+    }
+    if (grin->format == Format::AdjacencyList) {
+        return grin->provideFromAdjacencyLists(graph);
+    }
+    return grin->provideFromEdgeList(graph);
+}
+
+std::vector<Chunk> ParallelListReader::CheshireCat::split(const char *b, const char *e) const
+{
+    size_type threads = numThreads;
+    if (threads == 0U) {
+        threads = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    size_type bytes = static_cast<size_type>(e - b);
+    threads = std::max(size_type(1U), std::min(threads, bytes / MIN_BYTES_PER_THREAD));
+
+    std::vector<Chunk> chunks;
+    chunks.reserve(threads);
+    const char *chunkBegin = b;
+    for (size_type t = 1U; t <= threads && chunkBegin < e; t++) {
+        const char *chunkEnd = e;
+        if (t < threads) {
+            // cut right after the next line end
+            chunkEnd = std::max(b + bytes / threads * t, chunkBegin);
+            chunkEnd = lineEnd(chunkEnd, e);
+            if (chunkEnd != e) {
+                chunkEnd++;
+            }
+        }
+        chunks.emplace_back(chunkBegin, chunkEnd);
+        chunkBegin = chunkEnd;
+    }
+    return chunks;
+}
+
+void ParallelListReader::CheshireCat::countLines(Chunk &chunk) const
+{
+    chunk.numLines = static_cast<size_type>(std::count(chunk.begin, chunk.end, separators.getVertexSeparator()));
+    if (chunk.begin != chunk.end && chunk.end[-1] != separators.getVertexSeparator()) {
+        // unterminated last line
+        chunk.numLines++;
+    }
+}
+
+void ParallelListReader::CheshireCat::parseAdjacencyLists(Chunk &chunk, int numVertices) const
+{
+    const bool outgoing = separators.useOutgoingArcs();
+    size_type line = chunk.firstLine;
+    const char *p = chunk.begin;
+    while (p < chunk.end && line < static_cast<size_type>(numVertices)) {
+        const char *eol = lineEnd(p, chunk.end);
+        int currVertex = static_cast<int>(line);
+        bool ok = forEachToken(p, eol, [&](const char *b, const char *e) {
+            int adjVertex;
+            if (!toInt(b, e, &adjVertex, chunk.error)) {
+                return false;
+            }
+            if (adjVertex < 0 || adjVertex >= numVertices) {
+                std::ostringstream stringStream;
+                stringStream << "Illegal adjacency " << adjVertex << ".";
+                chunk.error = stringStream.str();
+                return false;
+            }
+            if (outgoing) {
+                chunk.arcs.emplace_back(currVertex, adjVertex);
+            } else {
+                chunk.arcs.emplace_back(adjVertex, currVertex);
+            }
+            return true;
+        });
+        p = eol == chunk.end ? eol : eol + 1;
+        if (!ok) {
+            chunk.failed = true;
+            chunk.graphEnd = p;
+            return;
+        }
+        line++;
+        if (line == static_cast<size_type>(numVertices)) {
+            chunk.graphEnd = p;
+        }
+    }
+}
+
+void ParallelListReader::CheshireCat::parseEdges(Chunk &chunk) const
+{
+    const char *p = chunk.begin;
+    while (p < chunk.end) {
+        const char *eol = lineEnd(p, chunk.end);
+        if (eol != p && *p != '#' && *p != '%') {
+            int ends[2];
+            int numTokens = 0;
+            bool ok = forEachToken(p, eol, [&](const char *b, const char *e) {
+                if (numTokens == 2) {
+                    numTokens++;
+                    return false;
+                }
+                if (!toInt(b, e, &ends[numTokens], chunk.error)) {
+                    return false;
+                }
+                if (ends[numTokens] < 0) {
+                    std::ostringstream stringStream;
+                    stringStream << "Illegal vertex " << ends[numTokens] << ".";
+                    chunk.error = stringStream.str();
+                    return false;
+                }
+                numTokens++;
+                return true;
+            });
+            if (ok && numTokens != 2) {
+                ok = false;
+            }
+            if (!ok) {
+                if (chunk.error.empty()) {
+                    chunk.error = "Expected exactly two vertices in line \"" + std::string(p, eol) + "\".";
+                }
+                chunk.failed = true;
+                return;
+            }
+            chunk.arcs.emplace_back(ends[0], ends[1]);
+            chunk.maxId = std::max(chunk.maxId, std::max(ends[0], ends[1]));
+        }
+        p = eol == chunk.end ? eol : eol + 1;
+    }
+}
+
+template<typename F>
+void ParallelListReader::CheshireCat::runParallel(std::vector<Chunk> &chunks, const F &f) const
+{
+    if (chunks.size() == 1U) {
+        f(chunks.front());
+        return;
+    }
+    std::vector<std::thread> threads;
+    threads.reserve(chunks.size());
+    for (Chunk &chunk : chunks) {
+        threads.emplace_back([&f, &chunk]() { f(chunk); });
+    }
+    for (std::thread &t : threads) {
+        t.join();
+    }
+}
+
+bool ParallelListReader::CheshireCat::provideFromAdjacencyLists(DiGraph *graph)
+{
+    const char *headerEnd = lineEnd(position, end);
+    std::string header(position, headerEnd);
+    position = headerEnd == end ? end : headerEnd + 1;
+    int numVertices;
+    if (!parseInt(header, &numVertices, lastError)) {
+        return false;
+    }
+    if (numVertices <= 0) {
+        return true;
+    }
+
+    std::vector<Chunk> chunks = split(position, end);
+    runParallel(chunks, [this](Chunk &chunk) { countLines(chunk); });
+    size_type line = 0U;
+    for (Chunk &chunk : chunks) {
+        chunk.firstLine = line;
+        line += chunk.numLines;
+    }
+    // chunks beyond the graph are not needed
+    while (chunks.size() > 1U && chunks.back().firstLine >= static_cast<size_type>(numVertices)) {
+        chunks.pop_back();
+    }
+    runParallel(chunks, [this,numVertices](Chunk &chunk) { parseAdjacencyLists(chunk, numVertices); });
+
+    for (Chunk &chunk : chunks) {
+        if (chunk.failed) {
+            lastError = chunk.error;
+            position = chunk.graphEnd;
+            build(graph, numVertices, std::vector<Chunk>());
+            return false;
+        }
+    }
+    position = end;
+    for (Chunk &chunk : chunks) {
+        if (chunk.graphEnd) {
+            position = chunk.graphEnd;
+            break;
+        }
+    }
+    build(graph, numVertices, chunks);
+    return true;
+}
+
+bool ParallelListReader::CheshireCat::provideFromEdgeList(DiGraph *graph)
+{
+    const auto inputSize = static_cast<std::uint64_t>(end - position);
+    std::vector<Chunk> chunks = split(position, end);
+    runParallel(chunks, [this](Chunk &chunk) { parseEdges(chunk); });
+
+    int maxId = -1;
+    BulkGraphBuilder::id_type numArcs = 0U;
+    for (Chunk &chunk : chunks) {
+        if (chunk.failed) {
+            lastError = chunk.error;
+            return false;
+        }
+        maxId = std::max(maxId, chunk.maxId);
+        numArcs += chunk.arcs.size();
+    }
+    position = end;
+
+    // ids up to the input size are taken as is; larger ones would create
+    // more vertices than the input could mention, so only used ids count then
+    const auto numVertices = static_cast<std::uint64_t>(maxId) + 1U;
+    BulkGraphBuilder builder(numVertices > inputSize);
+    builder.setNumVertices(numVertices);
+    bool ok = true;
+    try {
+        BulkGraphBuilder::ArcList arcs;
+        arcs.reserve(numArcs);
+        for (Chunk &chunk : chunks) {
+            for (const auto &[tail, head] : chunk.arcs) {
+                arcs.emplace_back(tail, head);
+            }
+            std::vector<std::pair<int,int>>().swap(chunk.arcs);
+        }
+        builder.setArcs(std::move(arcs));
+    } catch (const std::length_error &) {
+        ok = false;
+    } catch (const std::bad_alloc &) {
+        ok = false;
+    }
+    if (!ok || !builder.build(graph)) {
+        lastError = "Not enough memory for the graph.";
+        return false;
+    }
+    return true;
+}
+
+void ParallelListReader::CheshireCat::build(DiGraph *graph, int numVertices, const std::vector<Chunk> &chunks) const
+{
+    std::vector<Vertex*> vertices;
+    vertices.reserve(static_cast<size_type>(numVertices));
+    graph->beginTransaction();
+    for (int i = 0; i < numVertices; i++) {
+        vertices.push_back(graph->addVertex());
+    }
+    for (const Chunk &chunk : chunks) {
+        for (const auto &[tail, head] : chunk.arcs) {
+            graph->addArc(vertices[static_cast<size_type>(tail)], vertices[static_cast<size_type>(head)]);
+        }
+    }
+    graph->commitTransaction();
+}
+
+}
@@ -0,0 +1,81 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef PARALLELLISTREADER_H
+#define PARALLELLISTREADER_H
+
+#include "pipe/digraphprovider.h"
+#include "adjacencyliststringformat.h"
+
+#include <string>
+
+namespace Algora {
+
+class MappedFile;
+
+// Reads a graph from a memory range, e.g. a MappedFile, using several
+// threads. The input is split at line boundaries (vertex separators),
+// chunks are parsed concurrently and the graph is built afterwards in one go.
+//
+// AdjacencyList: same format, vertex and arc numbering and error messages
+// as AdjacencyListStringReader; consecutive graphs are read one by one.
+// EdgeList: one arc "tail<arc separator>head" per line, where vertex i is
+// the i-th vertex created and there are as many vertices as the largest
+// id plus one, unless that exceeds the input size in bytes: then only ids
+// that occur get a vertex, in increasing order of ids (see BulkGraphBuilder);
+// empty lines and lines starting with '#' or '%' are skipped.
+// The whole remaining input forms one graph.
+class ParallelListReader : public DiGraphProvider
+{
+public:
+    enum class Format { AdjacencyList, EdgeList };
+
+    explicit ParallelListReader(Format format = Format::AdjacencyList,
+                                AdjacencyListStringFormat separators = AdjacencyListStringFormat(),
+                                unsigned int numThreads = 0U);
+    virtual ~ParallelListReader() override;
+
+    ParallelListReader(const ParallelListReader &other) = delete;
+    ParallelListReader &operator=(const ParallelListReader &other) = delete;
+
+    void setInput(const char *begin, const char *end);
+    void setInput(const MappedFile &file);
+    // 0 means one thread per hardware thread
+    void setNumThreads(unsigned int numThreads);
+
+    // first unread byte
+    const char *getPosition() const;
+    std::string getLastError() const;
+
+    // DiGraphProvider interface
+public:
+    virtual bool isGraphAvailable() override;
+    virtual bool provideDiGraph(DiGraph *graph) override;
+
+private:
+    class CheshireCat;
+    CheshireCat *grin;
+};
+
+}
+
+#endif // PARALLELLISTREADER_H
@@ -0,0 +1,191 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "snapedgelistrw.h"
+
+#include "linetokenizer.h"
+#include "bulkgraphbuilder.h"
+#include "outputbuffer.h"
+#include "graph/digraph.h"
+#include "property/fastpropertymap.h"
+#include "pipe/digraphinfo.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <vector>
+
+namespace Algora {
+
+class SnapEdgeListRW::CheshireCat {
+public:
+    ModifiableProperty<double> *weights;
+    ModifiableProperty<unsigned long long> *ids;
+    std::string lastError;
+
+    CheshireCat() : weights(nullptr), ids(nullptr) { }
+
+    bool fail(const LineTokenizer &tokens, const std::string &error) {
+        lastError = "Line " + std::to_string(tokens.getLineNumber()) + ": " + error;
+        return false;
+    }
+
+    // "# Nodes: <n> Edges: <m>", as written by SNAP and processGraph()
+    static bool parseNodes(const char *begin, const char *end, std::uint64_t &n) {
+        static const char key[] = "Nodes:";
+        const char *p = std::search(begin, end, key, key + std::strlen(key));
+        if (p == end) {
+            return false;
+        }
+        p += std::strlen(key);
+        while (p != end && (*p == ' ' || *p == '\t')) {
+            p++;
+        }
+        return std::from_chars(p, end, n).ec == std::errc();
+    }
+};
+
+SnapEdgeListRW::SnapEdgeListRW()
+    : grin(new CheshireCat)
+{
+
+}
+
+SnapEdgeListRW::~SnapEdgeListRW()
+{
+    delete grin;
+}
+
+void SnapEdgeListRW::useArcWeights(ModifiableProperty<double> *weights)
+{
+    grin->weights = weights;
+}
+
+void SnapEdgeListRW::useVertexIds(ModifiableProperty<unsigned long long> *ids)
+{
+    grin->ids = ids;
+}
+
+std::string SnapEdgeListRW::getLastError() const
+{
+    return grin->lastError;
+}
+
+void SnapEdgeListRW::processGraph(const DiGraph *graph, const DiGraphInfo *info)
+{
+    if (StreamDiGraphWriter::outputStream == nullptr) {
+        return;
+    }
+    DiGraph *ncGraph = const_cast<DiGraph*>(graph);
+    DiGraphInfo defaultInfo(ncGraph);
+    if (!info) {
+        info = &defaultInfo;
+    }
+    std::vector<Vertex*> vertices;
+    FastPropertyMap<unsigned long long> index(0U);
+    info->mapVertices([&](Vertex *v) {
+        index.setValue(v, vertices.size());
+        vertices.push_back(v);
+    });
+    auto id = [this,&index](const Vertex *v) {
+        return grin->ids ? grin->ids->getValue(v) : index(v);
+    };
+
+    // a filtering info may hide arcs, so count those that are written
+    DiGraph::size_type numArcs = 0U;
+    if (info == &defaultInfo) {
+        numArcs = ncGraph->getNumArcs(true);
+    } else {
+        for (Vertex *v : vertices) {
+            info->mapOutgoingArcs(v, [&numArcs](Arc *) { numArcs++; });
+        }
+    }
+
+    OutputBuffer out(*(StreamDiGraphWriter::outputStream));
+    out.put("# Directed graph\n# Nodes: ");
+    out.putNumber(vertices.size());
+    out.put(" Edges: ");
+    out.putNumber(numArcs);
+    out.put(grin->weights ? "\n# FromNodeId\tToNodeId\tWeight\n" : "\n# FromNodeId\tToNodeId\n");
+    for (Vertex *v : vertices) {
+        auto tail = id(v);
+        info->mapOutgoingArcs(v, [&](Arc *a) {
+            out.putNumber(tail);
+            out.put('\t');
+            out.putNumber(id(a->getHead()));
+            if (grin->weights) {
+                out.put('\t');
+                out.putNumber(grin->weights->getValue(a));
+            }
+            out.put('\n');
+        });
+    }
+}
+
+bool SnapEdgeListRW::provideDiGraph(DiGraph *graph)
+{
+    if (!hasInput()) {
+        return false;
+    }
+    Lines input(*this);
+    LineTokenizer &tokens = input.tokens;
+    BulkGraphBuilder builder(true);
+    bool hasNumNodes = false;
+    std::uint64_t numNodes = 0U;
+    std::uint64_t maxId = 0U;
+    while (tokens.nextLine()) {
+        char c = tokens.peek();
+        if (c == '#' && !hasNumNodes) {
+            hasNumNodes = CheshireCat::parseNodes(tokens.getLine(), tokens.getLineEnd(), numNodes);
+        }
+        if (c == '\0' || c == '#' || c == '%') {
+            continue;
+        }
+        std::uint64_t tail;
+        std::uint64_t head;
+        if (!tokens.readUnsigned(tail) || !tokens.readUnsigned(head)) {
+            return grin->fail(tokens, "Expected two vertex ids.");
+        }
+        maxId = std::max(maxId, std::max(tail, head));
+        if (grin->weights && !tokens.atEndOfLine()) {
+            double weight;
+            if (!tokens.readDouble(weight)) {
+                return grin->fail(tokens, "Illegal weight.");
+            }
+            builder.addArc(tail, head, weight);
+        } else {
+            builder.addArc(tail, head);
+        }
+    }
+    if (hasNumNodes && (builder.getNumArcs() == 0U || maxId < numNodes)) {
+        // ids 0..n-1, keeps isolated vertices
+        builder.setSparseIds(false);
+        builder.setNumVertices(numNodes);
+    }
+    if (!builder.build(graph, grin->weights, grin->ids)) {
+        grin->lastError = "Not enough memory for the graph.";
+        return false;
+    }
+    return true;
+}
+
+}
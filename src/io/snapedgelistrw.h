@@ -0,0 +1,70 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef SNAPEDGELISTRW_H
+#define SNAPEDGELISTRW_H
+
+#include "streamdigraphwriter.h"
+#include "textdigraphreader.h"
+#include "property/modifiableproperty.h"
+
+#include <string>
+
+namespace Algora {
+
+// SNAP edge lists: one arc "tail head" per line, separated by blanks;
+// lines starting with '#' or '%' are comments. A third column is read as
+// arc weight if a weight property is set and ignored otherwise.
+// If a comment "# Nodes: n" announces n vertices and all ids are smaller,
+// vertex i has id i, so isolated vertices are kept. Otherwise, ids may be
+// sparse: there is one vertex per id that occurs, in increasing order of
+// ids, and isolated vertices are lost. The whole remaining input forms one
+// graph.
+class SnapEdgeListRW : public TextDiGraphReader, public StreamDiGraphWriter
+{
+public:
+    SnapEdgeListRW();
+    virtual ~SnapEdgeListRW() override;
+
+    // arc weights are read into and written from this property, if set
+    void useArcWeights(ModifiableProperty<double> *weights);
+    // original vertex ids are stored in and written from this property, if set
+    void useVertexIds(ModifiableProperty<unsigned long long> *ids);
+
+    std::string getLastError() const;
+
+    // DiGraphProcessor interface
+public:
+    virtual void processGraph(const DiGraph *graph, const DiGraphInfo *info = nullptr) override;
+
+    // DiGraphProvider interface
+public:
+    virtual bool provideDiGraph(DiGraph *graph) override;
+
+private:
+    class CheshireCat;
+    CheshireCat *grin;
+};
+
+}
+
+#endif // SNAPEDGELISTRW_H
@@ -201,5 +201,51 @@ void extractLeftMostKBits(boost::dynamic_bitset<> &bitset, unsigned int k, boost
     bitset.resize(bitset.size() - k);
 }
 
+unsigned int sparseSixK(std::uint64_t n)
+{
+    unsigned int k = 1U;
+    while ((std::uint64_t(1U) << k) < n) {
+        k++;
+    }
+    return k;
 }
 
+void appendSparseSixN(std::string &out, std::uint64_t n)
+{
+    SparseSixBitWriter bits(out);
+    if (n <= 62U) {
+        out.push_back(static_cast<char>(n + 63U));
+    } else if (n <= 258047U) {
+        out.push_back(126);
+        bits.putBits(n, 18U);
+    } else if (n <= 68719476735U) {
+        out.push_back(126);
+        out.push_back(126);
+        bits.putBits(n, 36U);
+    }
+}
+
+bool parseSparseSixN(const char *&begin, const char *end, std::uint64_t &n)
+{
+    if (begin == end) {
+        return false;
+    }
+    unsigned int chars = 1U;
+    if (*begin == 126) {
+        begin++;
+        chars = 3U;
+        if (begin != end && *begin == 126) {
+            begin++;
+            chars = 6U;
+        }
+    }
+    if (end - begin < static_cast<std::ptrdiff_t>(chars)) {
+        return false;
+    }
+    SparseSixBitReader bits(begin, begin + chars);
+    n = bits.getBits(6U * chars);
+    begin += chars;
+    return true;
+}
+
+}
@@ -24,6 +24,8 @@
 #define SPARSESIXFORMAT_H
 
 #include <vector>
+#include <string>
+#include <cstdint>
 #include <boost/dynamic_bitset.hpp>
 
 namespace Algora {
@@ -52,6 +54,118 @@ bool extractLeftMostBit(boost::dynamic_bitset<> &bitset);
 
 void extractLeftMostKBits(boost::dynamic_bitset<> &bitset, unsigned int k, boost::dynamic_bitset<> &kbits);
 
+// Streaming (de-)coding: bits are read and written most significant first,
+// six per character, through a 64-bit buffer.
+
+class SparseSixBitReader
+{
+public:
+    SparseSixBitReader(const char *begin, const char *end)
+        : next(begin), end(end), buffer(0U), bufferedBits(0U) { }
+
+    std::uint64_t remainingBits() const {
+        return bufferedBits + 6U * static_cast<std::uint64_t>(end - next);
+    }
+
+    // k must not exceed 58; missing bits are read as 0
+    std::uint64_t getBits(unsigned int k) {
+        if (bufferedBits < k) {
+            refill();
+            if (bufferedBits < k) {
+                buffer <<= (k - bufferedBits);
+                bufferedBits = k;
+            }
+        }
+        bufferedBits -= k;
+        return (buffer >> bufferedBits) & ((std::uint64_t(1U) << k) - 1U);
+    }
+
+    bool getBit() {
+        return getBits(1U) != 0U;
+    }
+
+private:
+    const char *next;
+    const char *end;
+    std::uint64_t buffer;
+    unsigned int bufferedBits;
+
+    void refill() {
+        while (bufferedBits <= 58U && next != end) {
+            buffer = (buffer << 6) | static_cast<std::uint64_t>((*next - 63) & 63);
+            bufferedBits += 6U;
+            next++;
+        }
+    }
+};
+
+class SparseSixBitWriter
+{
+public:
+    explicit SparseSixBitWriter(std::string &out)
+        : out(out), buffer(0U), bufferedBits(0U) { }
+
+    // k must not exceed 58
+    void putBits(std::uint64_t value, unsigned int k) {
+        buffer = (buffer << k) | (value & ((std::uint64_t(1U) << k) - 1U));
+        bufferedBits += k;
+        while (bufferedBits >= 6U) {
+            bufferedBits -= 6U;
+            out.push_back(static_cast<char>(((buffer >> bufferedBits) & 63U) + 63U));
+        }
+    }
+
+    void putBit(bool b) {
+        putBits(b ? 1U : 0U, 1U);
+    }
+
+    // number of bits needed to complete the current character
+    unsigned int getPadding() const {
+        return bufferedBits == 0U ? 0U : 6U - bufferedBits;
+    }
+
+    // pads the current character with zeros
+    void flush() {
+        putBits(0U, getPadding());
+    }
+
+private:
+    std::string &out;
+    std::uint64_t buffer;
+    unsigned int bufferedBits;
+};
+
+// number of bits per vertex index
+unsigned int sparseSixK(std::uint64_t n);
+
+void appendSparseSixN(std::string &out, std::uint64_t n);
+
+// parses N(n) and advances begin; returns false on malformed input
+bool parseSparseSixN(const char *&begin, const char *end, std::uint64_t &n);
+
+// calls edge(v, u) for every edge {v, u}, u <= v, encoded in the given
+// edge section of a sparse6 string with n vertices, in the order of encoding
+template<typename EdgeFun>
+void decodeSparseSixEdges(const char *begin, const char *end, std::uint64_t n, const EdgeFun &edge)
+{
+    unsigned int k = sparseSixK(n);
+    SparseSixBitReader bits(begin, end);
+    std::uint64_t cur = 0U;
+    while (bits.remainingBits() > k) {
+        if (bits.getBit()) {
+            cur++;
+        }
+        std::uint64_t v = bits.getBits(k);
+        if (v >= n || cur >= n) {
+            break;
+        } else if (v > cur) {
+            cur = v;
+        } else {
+            edge(cur, v);
+        }
+    }
+}
+
 }
 
 #endif // SPARSESIXFORMAT_H
@@ -25,12 +25,10 @@
 #include "sparsesixformat.h"
 #include "graph/digraph.h"
 #include "graph/parallelarcsbundle.h"
-#include "property/propertymap.h"
+#include "property/fastpropertymap.h"
 #include "pipe/digraphinfo.h"
 
 #include <ostream>
-#include <cmath>
-#include <tuple>
 #include <algorithm>
 
 #include <iostream>
@@ -66,102 +64,103 @@ void SparseSixGraphRW::processGraph(const DiGraph *graph, const DiGraphInfo *inf
         info = &defaultInfo;
     }
 
-    PropertyMap<int> vertexId(-1);
-    int i = 0;
-    info->mapVertices([&](Vertex *v) { vertexId[v] = i++; });
-
-    int n = ncGraph->getSize();
-    outputStream << ":";
-    std::vector<int> bytes;
-    sparseSixN(n, bytes);
-    printAscii(outputStream, bytes);
-    bytes.clear();
-
-    std::vector<std::tuple<int,int,bool> > arcs;
-    ArcMapping createTuple = [&](Arc *a) {
-        int h = vertexId[a->getHead()];
-        int t = vertexId[a->getTail()];
-        if (h <= t) {
-            arcs.push_back(std::make_tuple(t, h, true));
-        } else {
-            arcs.push_back(std::make_tuple(h, t, false));
-        }
-    };
-
-    ncGraph->mapArcs([&](Arc *arc) {
-        ParallelArcsBundle *pa = dynamic_cast<ParallelArcsBundle*>(arc);
-        if (!pa) {
-            createTuple(arc);
-        } else {
-            pa->mapArcs(createTuple);
-        }
+    FastPropertyMap<std::uint64_t> vertexId(0U);
+    std::vector<Vertex*> &order = vertices;
+    order.clear();
+    info->mapVertices([&](Vertex *v) {
+        vertexId[v] = order.size();
+        order.push_back(v);
     });
-    std::sort(arcs.begin(), arcs.end());
 
-    int k = 1;
-    while ((1 << k) < n) k++; //ceil(log2(n));
+    std::uint64_t n = ncGraph->getSize();
+    std::string &out = buffer;
+    out.clear();
+    out.push_back(':');
+    appendSparseSixN(out, n);
+
+    unsigned int k = sparseSixK(n);
     PRINT_DEBUG( "k: " << k )
-    boost::dynamic_bitset<> edgeBits;
-    boost::dynamic_bitset<> directionBits;
-
-    auto extendEdgeBits = [&](int w) {
-        edgeBits.resize(edgeBits.size() + k);
-        edgeBits <<= k;
-        boost::dynamic_bitset<> enc(edgeBits.size(), w);
-        edgeBits |= enc;
-    };
 
-    int cur = 0;
-    int v, u;
-    bool direction;
-    for (auto t : arcs) {
-        std::tie(v, u, direction) = t;
+    // Edges {v, u}, u <= v, are emitted ordered by v, as the format requires:
+    // from the outgoing arcs of v with head u <= v (direction bit 1) and
+    // from the incoming arcs of v with tail u < v (direction bit 0).
+    // Direction bits are collected separately and appended at the end;
+    // at one bit per edge, this buffer takes about m / 6 bytes.
+    // Edge bits are written out whenever FLUSH_THRESHOLD is reached.
+    SparseSixBitWriter edgeBits(out);
+    std::string &directions = directionBuffer;
+    directions.clear();
+    SparseSixBitWriter directionBits(directions);
+    std::uint64_t cur = 0U;
+    std::uint64_t v = 0U;
+    auto emit = [&](std::uint64_t u, bool direction) {
         PRINT_DEBUG( "Processing (" << v << "," << u << "," << direction << ")" )
         if (v == cur) {
-            prependBitset(edgeBits, false);
-            extendEdgeBits(u);
-        } else if (v == cur + 1) {
+            edgeBits.putBit(false);
+        } else if (v == cur + 1U) {
             cur++;
-            prependBitset(edgeBits, true);
-            extendEdgeBits(u);
+            edgeBits.putBit(true);
         } else {
             cur = v;
-            prependBitset(edgeBits, true);
-            extendEdgeBits(v);
-            prependBitset(edgeBits, false);
-            extendEdgeBits(u);
+            edgeBits.putBit(true);
+            edgeBits.putBits(v, k);
+            edgeBits.putBit(false);
         }
-        PRINT_DEBUG( edgeBits )
-        directionBits.push_back(direction);
-    }
-    int pad = 6 - (edgeBits.size() % 6);
-    if (pad < 6) {
-        edgeBits.resize(edgeBits.size() + pad);
-        edgeBits <<= pad;
-        if (k < 6 && n == (1 << k) && pad > k && cur < n-1) {
-            edgeBits[pad - 1] = false;
-            for (int i = 0; i < pad - 1; i++) {
-                edgeBits[i] = true;
-            }
+        edgeBits.putBits(u, k);
+        directionBits.putBit(direction);
+        if (out.size() >= FLUSH_THRESHOLD) {
+            outputStream.write(out.data(), static_cast<std::streamsize>(out.size()));
+            out.clear();
+        }
+    };
+    auto emitOutgoing = [&](Arc *a) {
+        auto h = vertexId(a->getHead());
+        if (h <= v) {
+            emit(h, true);
+        }
+    };
+    auto emitIncoming = [&](Arc *a) {
+        auto t = vertexId(a->getTail());
+        if (t < v) {
+            emit(t, false);
+        }
+    };
+    // bundles of size one behave like their only arc
+    ArcMapping mapOutgoing = [&](Arc *arc) {
+        ParallelArcsBundle *pa = arc->getSize() > 1U ? dynamic_cast<ParallelArcsBundle*>(arc) : nullptr;
+        if (!pa) {
+            emitOutgoing(arc);
+        } else {
+            pa->mapArcs(emitOutgoing);
+        }
+    };
+    ArcMapping mapIncoming = [&](Arc *arc) {
+        ParallelArcsBundle *pa = arc->getSize() > 1U ? dynamic_cast<ParallelArcsBundle*>(arc) : nullptr;
+        if (!pa) {
+            emitIncoming(arc);
         } else {
-            for (int i = 0; i < pad; i++) {
-                edgeBits[i] = true;
-            }
+            pa->mapArcs(emitIncoming);
         }
+    };
+    for (v = 0U; v < n; v++) {
+        info->mapOutgoingArcs(order[v], mapOutgoing);
+        info->mapIncomingArcs(order[v], mapIncoming);
     }
-    // reverse direction bits
-    PRINT_DEBUG( "direction: " << directionBits )
-    reverseBitset(directionBits);
-    PRINT_DEBUG( "direction: " << directionBits )
-
-    PRINT_DEBUG( "edge bits: " << edgeBits )
-    sparseSixR(edgeBits, bytes);
-    printAscii(outputStream, bytes);
-    outputStream << ":";
-    bytes.clear();
-    sparseSixR(directionBits, bytes);
-    printAscii(outputStream, bytes);
-    outputStream << std::endl;
+
+    unsigned int pad = edgeBits.getPadding();
+    if (pad > 0U) {
+        // padding must not be mistaken for an edge to vertex n - 1
+        if (k < 6U && n == (std::uint64_t(1U) << k) && pad > k && cur < n - 1U) {
+            edgeBits.putBit(false);
+            pad--;
+        }
+        edgeBits.putBits((std::uint64_t(1U) << pad) - 1U, pad);
+    }
+    out.push_back(':');
+    directionBits.flush();
+    out += directions;
+    out.push_back('\n');
+    outputStream.write(out.data(), static_cast<std::streamsize>(out.size()));
 }
 
 bool SparseSixGraphRW::provideDiGraph(DiGraph *graph)
@@ -170,75 +169,50 @@ bool SparseSixGraphRW::provideDiGraph(DiGraph *graph)
         return false;
     }
     std::istream &inputStream = *(StreamDiGraphReader::inputStream);
-    inputStream >> std::noskipws;
-    char colon = '\0';
-    inputStream >> colon;
-    PRINT_DEBUG( "1st colon: " << colon )
-    if (colon != ':') {
+    std::string &line = buffer;
+    if (!std::getline(inputStream, line)) {
+        std::cerr << "io: Missing first ':'." << std::endl;
+        return false;
+    }
+    if (!line.empty() && line.back() == '\r') {
+        line.pop_back();
+    }
+    const char *begin = line.data();
+    const char *end = begin + line.size();
+    if (begin == end || *begin != ':') {
         std::cerr << "io: Missing first ':'." << std::endl;
         return false;
     }
-    std::vector<int> bytes;
-    std::vector<int> direction;
-    asciiToInts(inputStream, bytes, ':');
-    inputStream >> colon;
-    PRINT_DEBUG( "2nd colon: " << colon )
-    if (colon != ':') {
+    begin++;
+    const char *edgesEnd = std::find(begin, end, ':');
+    if (edgesEnd == end) {
         std::cerr << "io: Missing second ':'." << std::endl;
         return false;
     }
-    asciiToInts(inputStream, direction, '\n');
-    // try to read newline character
-    if (inputStream.peek() == std::char_traits<char>::to_int_type('\n')) {
-        char eol;
-        inputStream >> eol;
-        PRINT_DEBUG( "EOL: " << eol )
-        if (eol != '\n') {
-            std::cerr << "io: Huh? There should have been a newline character." << std::endl;
-        }
+    std::uint64_t n = 0U;
+    if (!parseSparseSixN(begin, edgesEnd, n)) {
+        n = 0U;
     }
-    int n = extractSparseSixN(bytes);
     PRINT_DEBUG( "n = " << n )
-    unsigned int k = 1;
-    while ((1 << k) < n) k++;
-    PRINT_DEBUG( "k = " << k )
 
-    std::vector<Vertex*> vertices;
-    for (int i = 0; i < n; i++) {
+    vertices.clear();
+    vertices.reserve(n);
+    for (std::uint64_t i = 0U; i < n; i++) {
         vertices.push_back(graph->addVertex());
     }
-    boost::dynamic_bitset<> edgeBits;
-    boost::dynamic_bitset<> directionBits;
-    bytesToBitset(bytes, edgeBits);
-    bytesToBitset(direction, directionBits);
-
-    int cur = 0;
-    bool b;
-    boost::dynamic_bitset<> vBits;
-    int v;
-    while (edgeBits.size() > k) {
-        b = extractLeftMostBit(edgeBits);
-        extractLeftMostKBits(edgeBits, k, vBits);
-        v = vBits.to_ulong();
-        PRINT_DEBUG( b << " " << v )
-        if (b) {
-            cur++;
-        }
-        if (v >= n || cur >= n) {
-            break;
-        } else if (v > cur) {
-            cur = v;
+
+    SparseSixBitReader directionBits(edgesEnd + 1, end);
+    graph->beginTransaction();
+    decodeSparseSixEdges(begin, edgesEnd, n, [&](std::uint64_t cur, std::uint64_t v) {
+        if (directionBits.getBit()) {
+            graph->addArc(vertices[cur], vertices[v]);
+            PRINT_DEBUG( "(" << cur << "," << v << ")" )
         } else {
-            bool d = extractLeftMostBit(directionBits);
-            if (d) {
-                graph->addArc(vertices.at(cur), vertices.at(v));
-                PRINT_DEBUG( "(" << cur << "," << v << ")" )
-            } else {
-                graph->addArc(vertices.at(v), vertices.at(cur));
-                PRINT_DEBUG( "(" << v << "," << cur << ")" )
-            }
+            graph->addArc(vertices[v], vertices[cur]);
+            PRINT_DEBUG( "(" << v << "," << cur << ")" )
         }
-    }
+    });
+    graph->commitTransaction();
 
     return true;
 }
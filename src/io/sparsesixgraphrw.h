@@ -26,8 +26,14 @@
 #include "streamdigraphreader.h"
 #include "streamdigraphwriter.h"
 
+#include <cstdint>
+#include <string>
+#include <vector>
+
 namespace Algora {
 
+class Vertex;
+
 class SparseSixGraphRW : public StreamDiGraphReader, public StreamDiGraphWriter
 {
 public:
@@ -40,6 +46,16 @@ public:
     // DiGraphProvider interface
 public:
     virtual bool provideDiGraph(DiGraph *graph) override;
+
+private:
+    static const std::size_t FLUSH_THRESHOLD = 1U << 20;
+
+    // reused across graphs
+    std::string buffer;
+    // the direction section, which can only be written after the edge
+    // section: one character per six edges
+    std::string directionBuffer;
+    std::vector<Vertex*> vertices;
 };
 
 }
@@ -36,13 +36,15 @@ public:
         : inputStream(input), progressStream(progress) { }
     virtual ~StreamDiGraphReader() override { }
 
-    void setInputStream(std::istream *input) { inputStream = input; }
+    virtual void setInputStream(std::istream *input) { inputStream = input; }
     void setProgressStream(std::ostream *progress) { progressStream = progress; }
 
     // DiGraphProvider interface
 public:
     virtual bool isGraphAvailable() override {
-        return inputStream != nullptr && inputStream->good() && inputStream->rdbuf()->in_avail() > 0;
+        // in_avail() may be 0 for unbuffered or not yet filled streams
+        return inputStream != nullptr && inputStream->good()
+                && inputStream->peek() != std::istream::traits_type::eof();
     }
 
 protected:
@@ -0,0 +1,111 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "textdigraphreader.h"
+
+#include "linetokenizer.h"
+#include "mappedfile.h"
+
+namespace Algora {
+
+TextDiGraphReader::TextDiGraphReader(std::istream *input, char lineSeparator)
+    : StreamDiGraphReader(input), lineSeparator(lineSeparator), memoryEnd(nullptr)
+{
+
+}
+
+TextDiGraphReader::~TextDiGraphReader()
+{
+
+}
+
+void TextDiGraphReader::setInputStream(std::istream *input)
+{
+    StreamDiGraphReader::setInputStream(input);
+    memoryEnd = nullptr;
+}
+
+void TextDiGraphReader::setInput(const char *begin, const char *end)
+{
+    StreamDiGraphReader::setInputStream(nullptr);
+    memoryEnd = end;
+    getTokenizer().setInput(begin, end);
+}
+
+void TextDiGraphReader::setInput(const MappedFile &file)
+{
+    setInput(file.begin(), file.end());
+}
+
+const char *TextDiGraphReader::getPosition() const
+{
+    return memoryEnd ? tokenizer->getPosition() : nullptr;
+}
+
+bool TextDiGraphReader::isGraphAvailable()
+{
+    if (memoryEnd) {
+        return tokenizer->getPosition() != memoryEnd;
+    }
+    // input read ahead of a non-seekable stream is no longer in the stream
+    return StreamDiGraphReader::isGraphAvailable()
+            || (inputStream != nullptr && tokenizer && tokenizer->hasReadAhead(*inputStream));
+}
+
+bool TextDiGraphReader::hasInput() const
+{
+    return inputStream != nullptr || memoryEnd != nullptr;
+}
+
+LineTokenizer &TextDiGraphReader::getTokenizer()
+{
+    if (!tokenizer) {
+        if (inputStream) {
+            tokenizer.reset(new LineTokenizer(*inputStream, lineSeparator));
+        } else {
+            tokenizer.reset(new LineTokenizer(nullptr, nullptr, lineSeparator));
+        }
+    } else if (inputStream) {
+        tokenizer->setInput(*inputStream);
+    }
+    return *tokenizer;
+}
+
+TextDiGraphReader::Lines::Lines(TextDiGraphReader &reader)
+    : tokens(reader.getTokenizer()), reader(reader)
+{
+
+}
+
+TextDiGraphReader::Lines::~Lines()
+{
+    tokens.returnUnread();
+}
+
+void TextDiGraphReader::Lines::fail()
+{
+    if (reader.inputStream) {
+        reader.inputStream->setstate(std::ios_base::failbit);
+    }
+}
+
+}
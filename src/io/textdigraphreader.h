@@ -0,0 +1,92 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef TEXTDIGRAPHREADER_H
+#define TEXTDIGRAPHREADER_H
+
+#include "streamdigraphreader.h"
+
+#include <memory>
+
+namespace Algora {
+
+class LineTokenizer;
+class MappedFile;
+
+// Base of line-based readers. Besides an input stream, they can parse a
+// memory range, e.g. a MappedFile, in place via setInput().
+// Input read ahead of a stream is handed back if the stream can seek and is
+// kept for the next graph otherwise.
+class TextDiGraphReader : public StreamDiGraphReader
+{
+public:
+    explicit TextDiGraphReader(std::istream *input = nullptr, char lineSeparator = '\n');
+    virtual ~TextDiGraphReader() override;
+
+    TextDiGraphReader(const TextDiGraphReader &other) = delete;
+    TextDiGraphReader &operator=(const TextDiGraphReader &other) = delete;
+
+    // reads from the stream again
+    virtual void setInputStream(std::istream *input) override;
+    // the range must stay valid while graphs are read from it
+    void setInput(const char *begin, const char *end);
+    void setInput(const MappedFile &file);
+    // start of the remaining input in memory, or nullptr when reading a stream
+    const char *getPosition() const;
+
+    // DiGraphProvider interface
+public:
+    virtual bool isGraphAvailable() override;
+
+protected:
+    bool hasInput() const;
+
+    // Gives access to the lines of the input while reading one graph and
+    // hands back what was read ahead on destruction.
+    class Lines
+    {
+    public:
+        explicit Lines(TextDiGraphReader &reader);
+        ~Lines();
+
+        Lines(const Lines &other) = delete;
+        Lines &operator=(const Lines &other) = delete;
+
+        LineTokenizer &tokens;
+        // sets the failbit of the input stream, if any
+        void fail();
+
+    private:
+        TextDiGraphReader &reader;
+    };
+
+private:
+    char lineSeparator;
+    const char *memoryEnd;
+    std::unique_ptr<LineTokenizer> tokenizer;
+
+    LineTokenizer &getTokenizer();
+};
+
+}
+
+#endif // TEXTDIGRAPHREADER_H
@@ -0,0 +1,136 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef MEMORYUSAGE_H
+#define MEMORYUSAGE_H
+
+#include <vector>
+#include <unordered_map>
+#include <string>
+#include <sstream>
+#include <utility>
+#include <cstddef>
+
+namespace Algora {
+
+// Heap memory of a data structure in bytes: used is what the current
+// contents need, reserved what is actually allocated (including used).
+struct MemoryUsage
+{
+    std::size_t used = 0U;
+    std::size_t reserved = 0U;
+
+    MemoryUsage() = default;
+    MemoryUsage(std::size_t used, std::size_t reserved)
+        : used(used), reserved(reserved) { }
+
+    std::size_t getUnused() const { return reserved - used; }
+
+    MemoryUsage &operator+=(const MemoryUsage &rhs) {
+        used += rhs.used;
+        reserved += rhs.reserved;
+        return *this;
+    }
+    MemoryUsage operator+(const MemoryUsage &rhs) const {
+        MemoryUsage sum(*this);
+        return sum += rhs;
+    }
+
+    template<typename T, typename A>
+    static MemoryUsage of(const std::vector<T, A> &v) {
+        return MemoryUsage(v.size() * sizeof(T), v.capacity() * sizeof(T));
+    }
+
+    // estimate for node-based hash maps: one node (value plus link) per
+    // entry and one pointer per bucket, allocator overhead not included
+    template<typename K, typename V, typename H, typename E, typename A>
+    static MemoryUsage of(const std::unordered_map<K, V, H, E, A> &m) {
+        typedef typename std::unordered_map<K, V, H, E, A>::value_type value_type;
+        std::size_t nodes = m.size() * (sizeof(void*) + sizeof(value_type));
+        std::size_t buckets = static_cast<std::size_t>(m.size() / m.max_load_factor()) + 1U;
+        if (buckets > m.bucket_count()) {
+            buckets = m.bucket_count();
+        }
+        return MemoryUsage(nodes + buckets * sizeof(void*), nodes + m.bucket_count() * sizeof(void*));
+    }
+};
+
+// Named breakdown of the memory held by a composite structure, e.g., a graph.
+class MemoryReport
+{
+public:
+    typedef std::vector<std::pair<std::string, MemoryUsage>> PartList;
+
+    // adding to an existing part accumulates
+    void add(const std::string &part, const MemoryUsage &usage) {
+        for (auto &p : parts) {
+            if (p.first == part) {
+                p.second += usage;
+                return;
+            }
+        }
+        parts.emplace_back(part, usage);
+    }
+
+    void add(const MemoryReport &other) {
+        for (const auto &p : other.parts) {
+            add(p.first, p.second);
+        }
+    }
+
+    const PartList &getParts() const { return parts; }
+
+    MemoryUsage get(const std::string &part) const {
+        for (const auto &p : parts) {
+            if (p.first == part) {
+                return p.second;
+            }
+        }
+        return MemoryUsage();
+    }
+
+    MemoryUsage getTotal() const {
+        MemoryUsage total;
+        for (const auto &p : parts) {
+            total += p.second;
+        }
+        return total;
+    }
+
+    // one "part: used/reserved" line per part, in bytes
+    std::string toString() const {
+        std::ostringstream s;
+        for (const auto &p : parts) {
+            s << p.first << ": " << p.second.used << "/" << p.second.reserved << "\n";
+        }
+        auto total = getTotal();
+        s << "total: " << total.used << "/" << total.reserved << "\n";
+        return s.str();
+    }
+
+private:
+    PartList parts;
+};
+
+}
+
+#endif // MEMORYUSAGE_H
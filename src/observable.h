@@ -5,8 +5,11 @@
 #include <functional>
 #include <algorithm>
 #include <set>
+#include <tuple>
 #include <cassert>
 
+#include "memoryusage.h"
+
 namespace Algora {
 
 template<typename... Ts>
@@ -14,6 +17,7 @@ class Observable
 {
 public:
     typedef typename std::function<void(Ts...)> Notification;
+
     Observable() : notificationsInProgress(0U), delayedRemovals(false) { }
 
     Observable(const Observable &other) = delete;
@@ -22,19 +26,15 @@ public:
     Observable& operator=(Observable &&other) = default;
 
     void addObserver(void *id, const Notification &fun, bool delay = true) {
-        if (notificationsInProgress > 0 && delay) {
-            delayedAdditions.push_back({id, fun});
-        } else {
-            observers.push_back({id, fun});
-        }
+        add(Entry { id, fun }, delay);
     }
 
     void removeObserver(void *id, bool delay = true) {
         auto i = observers.begin();
         while (i != observers.end()) {
-            if (id == i->first) {
+            if (id == i->id) {
                 //i = observers.erase(i);
-                i->first = this;
+                i->id = this;
                 break;
             } else {
                 i++;
@@ -53,14 +53,106 @@ public:
 
     void notifyObservers(Ts... ts) {
         // no concurrency support!
-        notificationsInProgress++;
-        for (const auto &[id, fun] : observers) {
-            if (id != this) {
-                fun(ts...);
+        if (observers.empty()) {
+            return;
+        }
+        Notifying notifying(*this);
+        if (notificationsInProgress == 1U && observers.size() == 1U) {
+            // single observer outside of nested notifications: it cannot be
+            // marked as removed, and there is nothing to iterate
+            observers.front().fun(ts...);
+        } else {
+            for (const auto &o : observers) {
+                if (o.id != this) {
+                    o.fun(ts...);
+                }
+            }
+        }
+    }
+
+    // notifies those observers whose id satisfies the given predicate of each
+    // of the given elements in turn; the predicate is evaluated once per observer
+    template<typename IdPredicate, typename Container>
+    void notifyObserversIfOfEach(const IdPredicate &accept, const Container &elements) {
+        if (observers.empty()) {
+            return;
+        }
+        Notifying notifying(*this);
+        // additions are delayed, so observers keeps its size meanwhile
+        std::vector<bool> accepted;
+        accepted.reserve(observers.size());
+        for (const auto &o : observers) {
+            accepted.push_back(o.id != this && accept(o.id));
+        }
+        for (const auto &e : elements) {
+            for (auto i = 0U; i < observers.size(); i++) {
+                if (accepted[i] && observers[i].id != this) {
+                    observers[i].fun(e);
+                }
+            }
+        }
+    }
+
+    bool hasObservers() const {
+        return !observers.empty();
+    }
+
+    bool hasObserver(const void *id) const {
+        auto matches = [this,id](const Entry &o) { return o.id == id && o.id != this; };
+        return std::any_of(observers.cbegin(), observers.cend(), matches)
+                || std::any_of(delayedAdditions.cbegin(), delayedAdditions.cend(), matches);
+    }
+
+    void clear() {
+        observers.clear();
+    }
+
+    // captured state of std::function observers is not included
+    MemoryUsage memoryUsage() const {
+        return MemoryUsage::of(observers) + MemoryUsage::of(delayedAdditions);
+    }
+
+    void fit() {
+        if (notificationsInProgress == 0) {
+            observers.shrink_to_fit();
+            delayedAdditions.shrink_to_fit();
+        }
+    }
+
+private:
+    struct Entry {
+        void *id;
+        Notification fun;
+    };
+
+    unsigned int notificationsInProgress;
+    std::vector<Entry> observers;
+    std::vector<Entry> delayedAdditions;
+    bool delayedRemovals;
+
+    // marks a notification as in progress, also if an observer throws
+    struct Notifying {
+        explicit Notifying(Observable &o) : observable(o) {
+            observable.notificationsInProgress++;
+        }
+        ~Notifying() {
+            observable.notificationsInProgress--;
+            if (observable.delayedRemovals || !observable.delayedAdditions.empty()) {
+                observable.processDelayedChanges();
             }
         }
-        notificationsInProgress--;
+        Observable &observable;
+    };
 
+    void add(Entry &&entry, bool delay) {
+        if (notificationsInProgress > 0 && delay) {
+            delayedAdditions.push_back(std::move(entry));
+        } else {
+            observers.push_back(std::move(entry));
+        }
+    }
+
+    void processDelayedChanges() {
         if (notificationsInProgress == 0) {
             if (!delayedAdditions.empty()) {
                 std::move(delayedAdditions.begin(), delayedAdditions.end(), std::back_inserter(observers));
@@ -69,7 +161,7 @@ public:
 
             if (delayedRemovals) {
                 for (auto i = 0U; i < observers.size(); i++) {
-                    if (observers[i].first == this) {
+                    if (observers[i].id == this) {
                         observers[i] = std::move(observers.back());
                         observers.pop_back();
                         i--;
@@ -79,22 +171,36 @@ public:
             }
         }
     }
+};
 
-    bool hasObservers() const {
-        return !observers.empty();
+// Observer list that is fixed at compile time: notifications are plain
+// (inlinable) calls, there is neither type erasure nor bookkeeping.
+// Observers cannot be added or removed after construction.
+template<typename... Observers>
+class StaticObservable
+{
+public:
+    explicit StaticObservable(Observers... observers)
+        : observers(std::move(observers)...) { }
+
+    template<typename... Ts>
+    void notifyObservers(const Ts &...ts) {
+        std::apply([&ts...](auto &...o) { (o(ts...), ...); }, observers);
     }
 
-    void clear() {
-        observers.clear();
+    static constexpr bool hasObservers() {
+        return sizeof...(Observers) > 0;
     }
 
 private:
-    unsigned int notificationsInProgress;
-    std::vector<std::pair<void*, Notification>> observers;
-    std::vector<std::pair<void*, Notification>> delayedAdditions;
-    bool delayedRemovals;
+    std::tuple<Observers...> observers;
 };
 
+template<typename... Observers>
+StaticObservable<Observers...> makeStaticObservable(Observers... observers) {
+    return StaticObservable<Observers...>(std::move(observers)...);
+}
+
 }
 
 #endif // OBSERVABLE_H
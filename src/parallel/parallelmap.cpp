@@ -0,0 +1,85 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "parallelmap.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace Algora {
+
+namespace {
+// at most this many ranges, each of weight at least MIN_RANGE_WEIGHT
+constexpr DiGraph::size_type MAX_RANGES = 1024U;
+constexpr DiGraph::size_type MIN_RANGE_WEIGHT = 4096U;
+// vertices per block when computing the partition
+constexpr DiGraph::size_type BLOCK_SIZE = 1U << 16U;
+}
+
+VertexRanges partitionVerticesByDegree(const IncidenceListGraph &graph, WorkStealingPool &pool)
+{
+    typedef DiGraph::size_type size_type;
+    auto n = graph.getSize();
+    auto numBlocks = (n + BLOCK_SIZE - 1U) / BLOCK_SIZE;
+    auto weight = [&graph](size_type i) {
+        return 1U + graph.vertexAt(i)->getOutDegree(true);
+    };
+
+    // weight of all vertices before each block
+    std::vector<size_type> blockStart(numBlocks + 1U, 0U);
+    pool.run(numBlocks, [&](WorkStealingPool::size_type b, unsigned int) {
+        size_type sum = 0U;
+        for (auto i = b * BLOCK_SIZE; i < std::min(n, (b + 1U) * BLOCK_SIZE); i++) {
+            sum += weight(i);
+        }
+        blockStart[b + 1U] = sum;
+    });
+    std::partial_sum(blockStart.begin(), blockStart.end(), blockStart.begin());
+
+    auto total = blockStart.back();
+    auto numRanges = std::max<size_type>(1U, std::min(MAX_RANGES, total / MIN_RANGE_WEIGHT));
+    auto target = (total + numRanges - 1U) / numRanges;
+
+    // a range ends after each vertex whose weight reaches the next multiple
+    // of target, so that blocks can be scanned independently
+    std::vector<VertexRanges> ends(numBlocks);
+    pool.run(numBlocks, [&](WorkStealingPool::size_type b, unsigned int) {
+        auto before = blockStart[b];
+        for (auto i = b * BLOCK_SIZE; i < std::min(n, (b + 1U) * BLOCK_SIZE); i++) {
+            auto after = before + weight(i);
+            if (after / target > before / target && i + 1U < n) {
+                ends[b].push_back(i + 1U);
+            }
+            before = after;
+        }
+    });
+
+    VertexRanges ranges { 0U };
+    ranges.reserve(numRanges + 1U);
+    for (const auto &blockEnds : ends) {
+        ranges.insert(ranges.end(), blockEnds.begin(), blockEnds.end());
+    }
+    ranges.push_back(n);
+    return ranges;
+}
+
+}
@@ -0,0 +1,164 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef PARALLELMAP_H
+#define PARALLELMAP_H
+
+#include "workstealingpool.h"
+#include "graph.incidencelist/incidencelistgraph.h"
+#include "graph.incidencelist/incidencelistvertex.h"
+
+#include <vector>
+
+namespace Algora {
+
+// Parallel loops over the vertices and arcs of an IncidenceListGraph.
+// The graph is only read (see IncidenceListGraph), so it must not be modified
+// meanwhile. The functions passed are called concurrently and have to
+// synchronize access to shared state themselves; setValueAtId() on a
+// FastPropertyMap that already covers all ids is fine.
+// Vertices are processed in ranges of consecutive vertices of about equal
+// weight, where a vertex weighs one plus its out-degree. The ranges depend
+// only on the graph, not on the number of threads.
+// Computing them takes a parallel pass over all vertices; callers that map
+// the same graph repeatedly can compute them once and pass them to the
+// overloads taking VertexRanges, as long as the graph does not change.
+
+// range i consists of the vertices at indices ranges[i], ..., ranges[i + 1] - 1
+typedef std::vector<DiGraph::size_type> VertexRanges;
+
+VertexRanges partitionVerticesByDegree(const IncidenceListGraph &graph,
+                                       WorkStealingPool &pool = WorkStealingPool::getDefault());
+
+template<typename VertexFunction>
+void parallelMapVertices(const IncidenceListGraph &graph, const VertexRanges &ranges,
+                         const VertexFunction &vFun,
+                         WorkStealingPool &pool = WorkStealingPool::getDefault())
+{
+    pool.run(ranges.size() - 1U, [&](WorkStealingPool::size_type r, unsigned int) {
+        for (auto i = ranges[r]; i < ranges[r + 1U]; i++) {
+            vFun(graph.vertexAt(i));
+        }
+    });
+}
+
+template<typename VertexFunction>
+void parallelMapVertices(const IncidenceListGraph &graph, const VertexFunction &vFun,
+                         WorkStealingPool &pool = WorkStealingPool::getDefault())
+{
+    parallelMapVertices(graph, partitionVerticesByDegree(graph, pool), vFun, pool);
+}
+
+template<typename ArcFunction>
+void parallelMapArcs(const IncidenceListGraph &graph, const VertexRanges &ranges,
+                     const ArcFunction &aFun,
+                     WorkStealingPool &pool = WorkStealingPool::getDefault())
+{
+    pool.run(ranges.size() - 1U, [&](WorkStealingPool::size_type r, unsigned int) {
+        ArcMapping arcFun = [&aFun](Arc *a) { aFun(a); };
+        for (auto i = ranges[r]; i < ranges[r + 1U]; i++) {
+            graph.vertexAt(i)->mapOutgoingArcs(arcFun);
+        }
+    });
+}
+
+template<typename ArcFunction>
+void parallelMapArcs(const IncidenceListGraph &graph, const ArcFunction &aFun,
+                     WorkStealingPool &pool = WorkStealingPool::getDefault())
+{
+    parallelMapArcs(graph, partitionVerticesByDegree(graph, pool), aFun, pool);
+}
+
+// Reduces each range on its own via reduce(begin, end), then combines the
+// partial results in range order. For an associative combine with neutral
+// element identity, the result equals the sequential fold in vertex order;
+// in any case, it is the same on every run, e.g., for floating-point sums.
+template<typename T, typename RangeReduction, typename Combine>
+T parallelReduceRanges(const VertexRanges &ranges, const T &identity,
+                       const RangeReduction &reduce, const Combine &combine,
+                       WorkStealingPool &pool = WorkStealingPool::getDefault())
+{
+    // wrapped, so that partial results are separate objects even for bool
+    struct Partial { T value; };
+    std::vector<Partial> partials(ranges.size() - 1U, Partial { identity });
+    pool.run(partials.size(), [&](WorkStealingPool::size_type r, unsigned int) {
+        partials[r].value = reduce(ranges[r], ranges[r + 1U]);
+    });
+    T result = identity;
+    for (const auto &p : partials) {
+        result = combine(result, p.value);
+    }
+    return result;
+}
+
+template<typename T, typename VertexFunction, typename Combine>
+T parallelReduceVertices(const IncidenceListGraph &graph, const VertexRanges &ranges,
+                         const T &identity, const VertexFunction &map, const Combine &combine,
+                         WorkStealingPool &pool = WorkStealingPool::getDefault())
+{
+    return parallelReduceRanges(ranges, identity,
+                                [&](DiGraph::size_type begin, DiGraph::size_type end) {
+        T acc = identity;
+        for (auto i = begin; i < end; i++) {
+            acc = combine(acc, map(graph.vertexAt(i)));
+        }
+        return acc;
+    }, combine, pool);
+}
+
+template<typename T, typename VertexFunction, typename Combine>
+T parallelReduceVertices(const IncidenceListGraph &graph, const T &identity,
+                         const VertexFunction &map, const Combine &combine,
+                         WorkStealingPool &pool = WorkStealingPool::getDefault())
+{
+    return parallelReduceVertices(graph, partitionVerticesByDegree(graph, pool),
+                                  identity, map, combine, pool);
+}
+
+template<typename T, typename ArcFunction, typename Combine>
+T parallelReduceArcs(const IncidenceListGraph &graph, const VertexRanges &ranges,
+                     const T &identity, const ArcFunction &map, const Combine &combine,
+                     WorkStealingPool &pool = WorkStealingPool::getDefault())
+{
+    return parallelReduceRanges(ranges, identity,
+                                [&](DiGraph::size_type begin, DiGraph::size_type end) {
+        T acc = identity;
+        ArcMapping arcFun = [&](Arc *a) { acc = combine(acc, map(a)); };
+        for (auto i = begin; i < end; i++) {
+            graph.vertexAt(i)->mapOutgoingArcs(arcFun);
+        }
+        return acc;
+    }, combine, pool);
+}
+
+template<typename T, typename ArcFunction, typename Combine>
+T parallelReduceArcs(const IncidenceListGraph &graph, const T &identity,
+                     const ArcFunction &map, const Combine &combine,
+                     WorkStealingPool &pool = WorkStealingPool::getDefault())
+{
+    return parallelReduceArcs(graph, partitionVerticesByDegree(graph, pool),
+                              identity, map, combine, pool);
+}
+
+}
+
+#endif // PARALLELMAP_H
@@ -0,0 +1,220 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#include "workstealingpool.h"
+
+#include <algorithm>
+
+namespace Algora {
+
+namespace {
+// pool and worker index of the current thread while it processes chunks;
+// scopes of nested runs of different pools form a chain
+class WorkerScope
+{
+public:
+    WorkerScope(const WorkStealingPool *pool, unsigned int worker)
+        : pool(pool), worker(worker), outer(current) {
+        current = this;
+    }
+    ~WorkerScope() {
+        current = outer;
+    }
+
+    WorkerScope(const WorkerScope &other) = delete;
+    WorkerScope &operator=(const WorkerScope &other) = delete;
+
+    unsigned int getWorker() const { return worker; }
+
+    // innermost scope of pool on the current thread, if any
+    static const WorkerScope *find(const WorkStealingPool *pool) {
+        for (const WorkerScope *s = current; s; s = s->outer) {
+            if (s->pool == pool) {
+                return s;
+            }
+        }
+        return nullptr;
+    }
+
+private:
+    const WorkStealingPool *pool;
+    unsigned int worker;
+    const WorkerScope *outer;
+
+    static thread_local const WorkerScope *current;
+};
+
+thread_local const WorkerScope *WorkerScope::current = nullptr;
+}
+
+WorkStealingPool::WorkStealingPool(unsigned int numThreads)
+    : numThreads(numThreads), generation(0ULL), busy(0U), stopping(false),
+      job(nullptr), failed(false)
+{
+    if (this->numThreads == 0U) {
+        this->numThreads = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    queues.reset(new Queue[this->numThreads]);
+    threads.reserve(this->numThreads - 1U);
+    for (auto w = 1U; w < this->numThreads; w++) {
+        threads.emplace_back(&WorkStealingPool::work, this, w);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+    for (auto &t : threads) {
+        t.join();
+    }
+}
+
+void WorkStealingPool::run(size_type numChunks, const ChunkFunction &fun)
+{
+    if (numChunks == 0U) {
+        return;
+    }
+    const WorkerScope *scope = WorkerScope::find(this);
+    if (scope || numThreads == 1U || numChunks == 1U) {
+        for (size_type c = 0U; c < numChunks; c++) {
+            fun(c, scope ? scope->getWorker() : 0U);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> runLock(runMutex);
+    for (auto w = 0U; w < numThreads; w++) {
+        std::lock_guard<std::mutex> lock(queues[w].mutex);
+        queues[w].next = numChunks * w / numThreads;
+        queues[w].end = numChunks * (w + 1U) / numThreads;
+    }
+    job = &fun;
+    failed = false;
+    error = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        generation++;
+        busy = numThreads - 1U;
+    }
+    wakeUp.notify_all();
+
+    {
+        WorkerScope scope(this, 0U);
+        process(0U);
+    }
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this]() { return busy == 0U; });
+    }
+    job = nullptr;
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+WorkStealingPool &WorkStealingPool::getDefault()
+{
+    static WorkStealingPool pool;
+    return pool;
+}
+
+void WorkStealingPool::work(unsigned int worker)
+{
+    WorkerScope scope(this, worker);
+    auto seen = 0ULL;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wakeUp.wait(lock, [this,seen]() { return stopping || generation != seen; });
+            if (stopping) {
+                return;
+            }
+            seen = generation;
+        }
+        process(worker);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            busy--;
+            if (busy == 0U) {
+                done.notify_one();
+            }
+        }
+    }
+}
+
+void WorkStealingPool::process(unsigned int worker)
+{
+    size_type chunk;
+    while (!failed && (pop(worker, chunk) || steal(worker, chunk))) {
+        try {
+            (*job)(chunk, worker);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+            failed = true;
+        }
+    }
+}
+
+bool WorkStealingPool::pop(unsigned int worker, size_type &chunk)
+{
+    Queue &q = queues[worker];
+    std::lock_guard<std::mutex> lock(q.mutex);
+    if (q.next == q.end) {
+        return false;
+    }
+    chunk = q.next++;
+    return true;
+}
+
+bool WorkStealingPool::steal(unsigned int worker, size_type &chunk)
+{
+    for (auto i = 1U; i < numThreads; i++) {
+        Queue &victim = queues[(worker + i) % numThreads];
+        size_type begin, end;
+        {
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.next == victim.end) {
+                continue;
+            }
+            end = victim.end;
+            begin = end - (end - victim.next + 1U) / 2U;
+            victim.end = begin;
+        }
+        chunk = begin;
+        Queue &own = queues[worker];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        own.next = begin + 1U;
+        own.end = end;
+        return true;
+    }
+    return false;
+}
+
+}
@@ -0,0 +1,100 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef WORKSTEALINGPOOL_H
+#define WORKSTEALINGPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Algora {
+
+// Small pool of worker threads that process a range of chunks.
+// Each worker starts with an equal share of the chunks; a worker that has run
+// out of chunks steals half of the remaining ones of another worker.
+// The thread calling run() takes part as worker 0.
+class WorkStealingPool
+{
+public:
+    typedef std::size_t size_type;
+    typedef std::function<void(size_type chunk, unsigned int worker)> ChunkFunction;
+
+    // numThreads = 0: one per hardware thread
+    explicit WorkStealingPool(unsigned int numThreads = 0U);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool &other) = delete;
+    WorkStealingPool &operator=(const WorkStealingPool &other) = delete;
+
+    unsigned int getNumThreads() const { return numThreads; }
+
+    // Calls fun once for each chunk in [0, numChunks) and returns when all
+    // calls are done. Concurrent calls are run one after the other; calls
+    // from within fun are processed sequentially by the calling worker.
+    // If fun throws, the remaining chunks are skipped and the first exception
+    // is rethrown. Runs of different pools may be nested on one thread, e.g.,
+    // A.run() -> B.run() -> A.run(), but the worker threads of B must not call
+    // A.run() while the outer run waits for them.
+    void run(size_type numChunks, const ChunkFunction &fun);
+
+    // pool used by the parallel graph primitives, see parallelmap.h
+    static WorkStealingPool &getDefault();
+
+private:
+    struct alignas(64) Queue {
+        std::mutex mutex;
+        size_type next = 0U;
+        size_type end = 0U;
+    };
+
+    unsigned int numThreads;
+    std::unique_ptr<Queue[]> queues;
+    std::vector<std::thread> threads;
+
+    std::mutex runMutex;
+    std::mutex mutex;
+    std::condition_variable wakeUp;
+    std::condition_variable done;
+    unsigned long long generation;
+    unsigned int busy;
+    bool stopping;
+
+    const ChunkFunction *job;
+    std::atomic<bool> failed;
+    std::exception_ptr error;
+
+    void work(unsigned int worker);
+    void process(unsigned int worker);
+    bool pop(unsigned int worker, size_type &chunk);
+    bool steal(unsigned int worker, size_type &chunk);
+};
+
+}
+
+#endif // WORKSTEALINGPOOL_H
@@ -0,0 +1,239 @@
+/**
+ * Copyright (C) 2013 - 2019 : Kathrin Hanauer
+ *
+ * This file is part of Algora.
+ *
+ * Algora is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Algora is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Algora.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Contact information:
+ *   http://algora.xaikal.org
+ */
+
+#ifndef DIGRAPHPIPELINE_H
+#define DIGRAPHPIPELINE_H
+
+#include "digraphprovider.h"
+#include "graph.incidencelist/incidencelistgraph.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Algora {
+
+// Runs a provider -> workers -> sink pipeline:
+// one thread pulls graphs from the provider, a pool of workers computes a
+// Result for each graph, and the sink receives the results on the thread
+// that called run(), either in the order the graphs were provided or as
+// soon as they are available.
+// At most getCapacity() graphs are in flight at any time; the provider is
+// stalled until the sink has caught up (backpressure). Graph objects are
+// recycled via clear(), so they must not be referenced by results.
+// To run DiGraphProcessors, give each worker its own instance and call it
+// from the work function, which receives the worker's index.
+template<typename Result>
+class DiGraphPipeline
+{
+public:
+    typedef unsigned long long size_type;
+    typedef std::function<DiGraph*()> GraphFactory;
+    typedef std::function<Result(DiGraph *graph, unsigned int worker)> Worker;
+    typedef std::function<void(size_type sequence, Result &&result)> Sink;
+
+    // numWorkers = 0: one per hardware thread; capacity = 0: 4 per worker
+    explicit DiGraphPipeline(unsigned int numWorkers = 0U, size_type capacity = 0U, bool ordered = true)
+        : numWorkers(numWorkers), capacity(capacity), ordered(ordered),
+          createGraph([]() { return new IncidenceListGraph; }) { }
+
+    void setNumWorkers(unsigned int n) { numWorkers = n; }
+    unsigned int getNumWorkers() const {
+        if (numWorkers > 0U) {
+            return numWorkers;
+        }
+        auto hw = std::thread::hardware_concurrency();
+        return hw > 0U ? hw : 1U;
+    }
+    void setCapacity(size_type c) { capacity = c; }
+    size_type getCapacity() const { return capacity > 0U ? capacity : 4U * getNumWorkers(); }
+    void setOrdered(bool o) { ordered = o; }
+    bool isOrdered() const { return ordered; }
+    void setGraphFactory(const GraphFactory &factory) { createGraph = factory; }
+
+    // processes graphs until the provider has no more graphs or fails to
+    // provide one; exceptions thrown by work or sink stop the pipeline and
+    // are rethrown; returns the number of results delivered to the sink
+    size_type run(DiGraphProvider *provider, const Worker &work, const Sink &sink);
+
+private:
+    unsigned int numWorkers;
+    size_type capacity;
+    bool ordered;
+    GraphFactory createGraph;
+};
+
+template<typename Result>
+typename DiGraphPipeline<Result>::size_type
+DiGraphPipeline<Result>::run(DiGraphProvider *provider, const Worker &work, const Sink &sink)
+{
+    const unsigned int workers = getNumWorkers();
+    const size_type maxInFlight = getCapacity();
+
+    std::mutex mutex;
+    std::condition_variable producerCV;
+    std::condition_variable workerCV;
+    std::condition_variable sinkCV;
+
+    std::vector<std::unique_ptr<DiGraph>> graphs;
+    std::vector<DiGraph*> idleGraphs;
+    std::deque<std::pair<size_type, DiGraph*>> input;
+    std::deque<std::pair<size_type, Result>> output;
+    size_type inFlight = 0U;
+    bool producerDone = false;
+    unsigned int workersDone = 0U;
+    bool stop = false;
+    std::exception_ptr error;
+
+    auto fail = [&](std::exception_ptr e) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!error) {
+            error = e;
+        }
+        stop = true;
+        producerCV.notify_all();
+        workerCV.notify_all();
+        sinkCV.notify_all();
+    };
+
+    std::thread producer([&]() {
+        try {
+            size_type sequence = 0U;
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true) {
+                producerCV.wait(lock, [&]() { return stop || inFlight < maxInFlight; });
+                if (stop) {
+                    break;
+                }
+                DiGraph *graph = nullptr;
+                if (!idleGraphs.empty()) {
+                    graph = idleGraphs.back();
+                    idleGraphs.pop_back();
+                } else {
+                    graphs.emplace_back(createGraph());
+                    graph = graphs.back().get();
+                }
+                lock.unlock();
+                bool ok = provider->isGraphAvailable() && provider->provideDiGraph(graph);
+                lock.lock();
+                if (!ok) {
+                    graph->clear();
+                    idleGraphs.push_back(graph);
+                    break;
+                }
+                input.emplace_back(sequence++, graph);
+                inFlight++;
+                workerCV.notify_one();
+            }
+            producerDone = true;
+            workerCV.notify_all();
+        } catch (...) {
+            fail(std::current_exception());
+        }
+    });
+
+    std::vector<std::thread> pool;
+    pool.reserve(workers);
+    for (auto w = 0U; w < workers; w++) {
+        pool.emplace_back([&,w]() {
+            try {
+                std::unique_lock<std::mutex> lock(mutex);
+                while (true) {
+                    workerCV.wait(lock, [&]() { return stop || !input.empty() || producerDone; });
+                    if (stop || input.empty()) {
+                        break;
+                    }
+                    auto job = input.front();
+                    input.pop_front();
+                    lock.unlock();
+                    Result result = work(job.second, w);
+                    job.second->clear();
+                    lock.lock();
+                    idleGraphs.push_back(job.second);
+                    output.emplace_back(job.first, std::move(result));
+                    sinkCV.notify_one();
+                }
+            } catch (...) {
+                fail(std::current_exception());
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            workersDone++;
+            sinkCV.notify_one();
+        });
+    }
+
+    size_type delivered = 0U;
+    std::map<size_type, Result> pending;
+    try {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            sinkCV.wait(lock, [&]() { return stop || !output.empty() || workersDone == workers; });
+            if (stop || (output.empty() && workersDone == workers)) {
+                break;
+            }
+            std::deque<std::pair<size_type, Result>> batch;
+            batch.swap(output);
+            lock.unlock();
+            size_type count = 0U;
+            if (ordered) {
+                for (auto &r : batch) {
+                    pending.emplace(r.first, std::move(r.second));
+                }
+                for (auto i = pending.begin(); i != pending.end() && i->first == delivered; i = pending.erase(i)) {
+                    sink(i->first, std::move(i->second));
+                    delivered++;
+                    count++;
+                }
+            } else {
+                for (auto &r : batch) {
+                    sink(r.first, std::move(r.second));
+                    delivered++;
+                    count++;
+                }
+            }
+            lock.lock();
+            inFlight -= count;
+            producerCV.notify_one();
+        }
+    } catch (...) {
+        fail(std::current_exception());
+    }
+
+    producer.join();
+    for (auto &t : pool) {
+        t.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return delivered;
+}
+
+}
+
+#endif // DIGRAPHPIPELINE_H
@@ -25,6 +25,7 @@ message("pri file being processed: $$PWD")
 HEADERS += \ 
     $$PWD/digraphprovider.h \
     $$PWD/digraphprocessor.h \
-    $$PWD/digraphinfo.h
+    $$PWD/digraphinfo.h \
+    $$PWD/digraphpipeline.h
 
 SOURCES +=    
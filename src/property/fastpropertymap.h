@@ -25,6 +25,7 @@
 
 #include "modifiableproperty.h"
 #include "graph/graphartifact.h"
+#include "graph/idmapping.h"
 #include <cassert>
 
 #include <vector>
@@ -104,6 +105,15 @@ public:
         return buckets.size();
     }
 
+    MemoryUsage memoryUsage() const {
+        return MemoryUsage::of(buckets) + this->observable.memoryUsage();
+    }
+
+    // follows a renumbering of the graph's artifacts, see IncidenceListGraph::compact()
+    void permute(const IdMapping &mapping) {
+        permuteById(buckets, mapping, defaultValue);
+    }
+
     virtual T &operator[](const GraphArtifact *ga) override {
         auto id = ga->getId();
         enlarge(id);
@@ -162,6 +172,7 @@ private:
         if (size < buckets.size()) {
             return;
         }
+        this->countResize();
         buckets.resize(size + 1, defaultValue);
     }
 
@@ -227,6 +238,14 @@ public:
         return buckets.size();
     }
 
+    MemoryUsage memoryUsage() const {
+        return MemoryUsage::of(buckets) + this->observable.memoryUsage();
+    }
+
+    void permute(const IdMapping &mapping) {
+        permuteById(buckets, mapping, static_cast<char>(defaultValue));
+    }
+
     virtual bool &operator[](const GraphArtifact *ga) override {
         auto id = ga->getId();
         enlarge(id);
@@ -261,6 +280,7 @@ private:
         if (size < buckets.size()) {
             return;
         }
+        this->countResize();
         buckets.resize(size + 1, defaultValue);
     }
 
@@ -69,8 +69,22 @@ public:
         observable.removeObserver(id);
     }
 
+    // number of times the underlying storage grew; only counted if
+    // ALGORA_PROFILING is defined
+    unsigned long long getNumResizes() const {
+        return numResizes;
+    }
+
 protected:
     Observable<GraphArtifact*, T, T> observable;
+    // present in any case, so that the layout does not depend on the flag
+    unsigned long long numResizes = 0ULL;
+
+    void countResize() {
+#ifdef ALGORA_PROFILING
+        numResizes++;
+#endif
+    }
 
     void updateObservers(const GraphArtifact *cga, const T &oldValue, const T&newValue) {
         auto *ga = const_cast<GraphArtifact*>(cga);
@@ -71,6 +71,9 @@ public:
     }
 
     virtual void setValue(const GraphArtifact *ga, const T &value) override {
+#ifdef ALGORA_PROFILING
+        auto buckets = map.bucket_count();
+#endif
         if (!this->observable.hasObservers()) {
             map[ga] = value;
         } else {
@@ -78,6 +81,11 @@ public:
             map[ga] = value;
             this->updateObservers(ga, oldValue, value);
         }
+#ifdef ALGORA_PROFILING
+        if (map.bucket_count() != buckets) {
+            this->countResize();
+        }
+#endif
     }
 
     void resetToDefault(const GraphArtifact *ga) {
@@ -89,6 +97,15 @@ public:
         }
     }
 
+    // shrinks the bucket array to what the current entries need
+    void fit() {
+        map.rehash(0U);
+    }
+
+    MemoryUsage memoryUsage() const {
+        return MemoryUsage::of(map) + this->observable.memoryUsage();
+    }
+
     void resetAll() {
         if (this->observable.hasObservers()) {
             for (const auto &[ga, oldValue] : map) {
@@ -101,7 +118,15 @@ public:
 
     virtual T &operator[](const GraphArtifact *ga) override {
         if (!isSetExplicitly(ga)) {
+#ifdef ALGORA_PROFILING
+            auto buckets = map.bucket_count();
+#endif
             map[ga] = defaultValue;
+#ifdef ALGORA_PROFILING
+            if (map.bucket_count() != buckets) {
+                this->countResize();
+            }
+#endif
         }
         return map[ga];
     }